@@ -0,0 +1,367 @@
+#ifndef VARIADIC_TEMPLATES_HASH64_HPP
+#define VARIADIC_TEMPLATES_HASH64_HPP
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define VARIADIC_TEMPLATES_HAS_SSE2
+#endif
+
+#if defined(_MSC_VER) && defined(_M_X64)
+#include <intrin.h>
+#endif
+
+/////////////////////////////////////////////////////////////////
+// 64-bit hashing
+//
+// Byte sequences are hashed with a wyhash-style function (128-bit multiply & fold).
+// Integers, enums and floating point numbers are mixed with the SplitMix64 finalizer,
+// which uses only shifts, xors and 64-bit multiplies - hash64_batch() computes it
+// for several keys at once with SIMD and returns exactly the same values.
+// Hash values depend on the byte order of the platform.
+//
+namespace vt
+{
+    namespace details
+    {
+        inline constexpr uint64_t hash_secret[4] = {0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull};
+
+        // a, b = low and high half of a * b
+        inline void multiply_128(uint64_t& a, uint64_t& b)
+        {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 r = static_cast<unsigned __int128>(a) * b;
+            a = static_cast<uint64_t>(r);
+            b = static_cast<uint64_t>(r >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            const uint64_t ha = a >> 32, hb = b >> 32, la = static_cast<uint32_t>(a), lb = static_cast<uint32_t>(b);
+            const uint64_t rh = ha * hb, rm0 = ha * lb, rm1 = hb * la, rl = la * lb;
+            const uint64_t t = rl + (rm0 << 32);
+            uint64_t carry = t < rl;
+            const uint64_t lo = t + (rm1 << 32);
+            carry += lo < t;
+            a = lo;
+            b = rh + (rm0 >> 32) + (rm1 >> 32) + carry;
+#endif
+        }
+
+        inline uint64_t multiply_fold(uint64_t a, uint64_t b)
+        {
+            multiply_128(a, b);
+            return a ^ b;
+        }
+
+        inline uint64_t read64(const uint8_t* p)
+        {
+            uint64_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        inline uint64_t read32(const uint8_t* p)
+        {
+            uint32_t value;
+            std::memcpy(&value, p, sizeof(value));
+            return value;
+        }
+
+        // 1-3 bytes
+        inline uint64_t read_small(const uint8_t* p, size_t size)
+        {
+            return (uint64_t{p[0]} << 16) | (uint64_t{p[size >> 1]} << 8) | p[size - 1];
+        }
+
+        constexpr uint64_t mix64(uint64_t x)
+        {
+            x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+            x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+            return x ^ (x >> 31);
+        }
+
+        constexpr uint64_t hash_word(uint64_t key, uint64_t seed)
+        {
+            return mix64(key ^ seed ^ hash_secret[0]);
+        }
+
+        template <typename T>
+        constexpr uint64_t to_word(T value)
+        {
+            if constexpr (std::is_enum_v<T>)
+                return to_word(static_cast<std::underlying_type_t<T>>(value));
+            else if constexpr (std::same_as<T, bool>)
+                return value;
+            else
+                return static_cast<uint64_t>(static_cast<std::make_unsigned_t<T>>(value));
+        }
+    } // namespace details
+
+    inline uint64_t hash_bytes(const void* data, size_t size, uint64_t seed = 0)
+    {
+        using namespace details;
+
+        const uint8_t* p = static_cast<const uint8_t*>(data);
+        seed ^= multiply_fold(seed ^ hash_secret[0], hash_secret[1]);
+
+        uint64_t a, b;
+
+        if (size <= 16)
+        {
+            if (size >= 4)
+            {
+                const size_t offset = (size >> 3) << 2;
+                a = (read32(p) << 32) | read32(p + offset);
+                b = (read32(p + size - 4) << 32) | read32(p + size - 4 - offset);
+            }
+            else if (size > 0)
+            {
+                a = read_small(p, size);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else
+        {
+            size_t remaining = size;
+
+            if (remaining > 48) // three independent lanes
+            {
+                uint64_t seed1 = seed, seed2 = seed;
+
+                do
+                {
+                    seed = multiply_fold(read64(p) ^ hash_secret[1], read64(p + 8) ^ seed);
+                    seed1 = multiply_fold(read64(p + 16) ^ hash_secret[2], read64(p + 24) ^ seed1);
+                    seed2 = multiply_fold(read64(p + 32) ^ hash_secret[3], read64(p + 40) ^ seed2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+
+                seed ^= seed1 ^ seed2;
+            }
+
+            while (remaining > 16)
+            {
+                seed = multiply_fold(read64(p) ^ hash_secret[1], read64(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+
+            a = read64(p + remaining - 16);
+            b = read64(p + remaining - 8);
+        }
+
+        a ^= hash_secret[1];
+        b ^= seed;
+        multiply_128(a, b);
+
+        return multiply_fold(a ^ hash_secret[0] ^ size, b ^ hash_secret[1]);
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // Hasher<T> - customization point (specialize for own types)
+    //
+    template <typename T>
+    struct Hasher;
+
+    template <typename T>
+    concept Hashable64 = requires(const T& value, uint64_t seed) {
+        { Hasher<std::remove_cvref_t<T>>{}(value, seed) } -> std::same_as<uint64_t>;
+    };
+
+    template <Hashable64 T>
+    uint64_t hash64(const T& value, uint64_t seed = 0)
+    {
+        return Hasher<std::remove_cvref_t<T>>{}(value, seed);
+    }
+
+    // integers & enums
+    template <typename T>
+        requires((std::integral<T> || std::is_enum_v<T>) && sizeof(T) <= sizeof(uint64_t))
+    struct Hasher<T>
+    {
+        constexpr uint64_t operator()(T value, uint64_t seed) const
+        {
+            return details::hash_word(details::to_word(value), seed);
+        }
+    };
+
+    // floating points - 0.0 and -0.0 compare equal, so they hash equal
+    template <typename T>
+        requires(std::same_as<T, float> || std::same_as<T, double>)
+    struct Hasher<T>
+    {
+        uint64_t operator()(T value, uint64_t seed) const
+        {
+            using TBits = std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+            return details::hash_word(std::bit_cast<TBits>(value == T{} ? T{} : value), seed);
+        }
+    };
+
+    // contiguous ranges of items without padding (strings, string_views, vectors, arrays, spans...)
+    template <typename T>
+        requires std::ranges::contiguous_range<T> && std::ranges::sized_range<T>
+            && std::has_unique_object_representations_v<std::ranges::range_value_t<T>>
+    struct Hasher<T>
+    {
+        uint64_t operator()(const T& items, uint64_t seed) const
+        {
+            return hash_bytes(std::ranges::data(items), std::ranges::size(items) * sizeof(std::ranges::range_value_t<T>), seed);
+        }
+    };
+
+    // C-strings are hashed by content - the same value as std::string & std::string_view
+    template <>
+    struct Hasher<const char*>
+    {
+        uint64_t operator()(const char* text, uint64_t seed) const
+        {
+            return hash64(std::string_view{text}, seed);
+        }
+    };
+
+    template <>
+    struct Hasher<char*> : Hasher<const char*>
+    { };
+
+    template <size_t N>
+    struct Hasher<char[N]> : Hasher<const char*>
+    { };
+
+    // tuples & pairs - hash of every item is a seed of the next one (order matters)
+    template <Hashable64... Ts>
+    struct Hasher<std::tuple<Ts...>>
+    {
+        uint64_t operator()(const std::tuple<Ts...>& tpl, uint64_t seed) const
+        {
+            std::apply([&seed](const auto&... items) { ((seed = hash64(items, seed)), ...); }, tpl);
+            return seed;
+        }
+    };
+
+    template <Hashable64 T1, Hashable64 T2>
+    struct Hasher<std::pair<T1, T2>>
+    {
+        uint64_t operator()(const std::pair<T1, T2>& pair, uint64_t seed) const
+        {
+            return hash64(pair.second, hash64(pair.first, seed));
+        }
+    };
+
+    template <Hashable64... Ts>
+    uint64_t combined_hash64(const Ts&... args)
+    {
+        uint64_t seed{0};
+        ((seed = hash64(args, seed)), ...);
+        return seed;
+    }
+
+    /////////////////////////////////////////////////////////////////
+    // hash64_batch - out[i] = hash64(keys[i], seed)
+    //
+    namespace details
+    {
+        template <typename T>
+        concept SimdHashableKey = (std::integral<T> || std::is_enum_v<T>) && (sizeof(T) == 4 || sizeof(T) == 8);
+
+#ifdef VARIADIC_TEMPLATES_HAS_SSE2
+        // low 64 bits of a * b in every lane (there is no 64-bit multiply below AVX-512)
+        inline __m128i mullo_epi64(__m128i a, __m128i b)
+        {
+            const __m128i lo = _mm_mul_epu32(a, b);
+            const __m128i cross = _mm_add_epi64(_mm_mul_epu32(_mm_srli_epi64(a, 32), b), _mm_mul_epu32(a, _mm_srli_epi64(b, 32)));
+            return _mm_add_epi64(lo, _mm_slli_epi64(cross, 32));
+        }
+
+        inline __m128i mix64(__m128i x)
+        {
+            x = mullo_epi64(_mm_xor_si128(x, _mm_srli_epi64(x, 30)), _mm_set1_epi64x(static_cast<int64_t>(0xbf58476d1ce4e5b9ull)));
+            x = mullo_epi64(_mm_xor_si128(x, _mm_srli_epi64(x, 27)), _mm_set1_epi64x(static_cast<int64_t>(0x94d049bb133111ebull)));
+            return _mm_xor_si128(x, _mm_srli_epi64(x, 31));
+        }
+#endif
+
+#if defined(__AVX2__)
+        inline __m256i mullo_epi64(__m256i a, __m256i b)
+        {
+            const __m256i lo = _mm256_mul_epu32(a, b);
+            const __m256i cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+            return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+        }
+
+        inline __m256i mix64(__m256i x)
+        {
+            x = mullo_epi64(_mm256_xor_si256(x, _mm256_srli_epi64(x, 30)), _mm256_set1_epi64x(static_cast<int64_t>(0xbf58476d1ce4e5b9ull)));
+            x = mullo_epi64(_mm256_xor_si256(x, _mm256_srli_epi64(x, 27)), _mm256_set1_epi64x(static_cast<int64_t>(0x94d049bb133111ebull)));
+            return _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+        }
+#endif
+
+        // returns number of keys hashed
+        template <SimdHashableKey T>
+        size_t hash64_batch_simd(const T* keys, size_t size, uint64_t* out, uint64_t seed)
+        {
+            size_t i = 0;
+
+#if defined(__AVX2__)
+            const __m256i salt = _mm256_set1_epi64x(static_cast<int64_t>(seed ^ hash_secret[0]));
+
+            for (; i + 4 <= size; i += 4)
+            {
+                __m256i words;
+                if constexpr (sizeof(T) == 8)
+                    words = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(keys + i));
+                else
+                    words = _mm256_cvtepu32_epi64(_mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i)));
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), mix64(_mm256_xor_si256(words, salt)));
+            }
+#elif defined(VARIADIC_TEMPLATES_HAS_SSE2)
+            const __m128i salt = _mm_set1_epi64x(static_cast<int64_t>(seed ^ hash_secret[0]));
+
+            for (; i + 2 <= size; i += 2)
+            {
+                __m128i words;
+                if constexpr (sizeof(T) == 8)
+                    words = _mm_loadu_si128(reinterpret_cast<const __m128i*>(keys + i));
+                else
+                    words = _mm_unpacklo_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(keys + i)), _mm_setzero_si128());
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), mix64(_mm_xor_si128(words, salt)));
+            }
+#endif
+
+            return i;
+        }
+    } // namespace details
+
+    template <Hashable64 T>
+    uint64_t* hash64_batch(const T* begin, const T* end, uint64_t* out, uint64_t seed = 0)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+
+        if constexpr (details::SimdHashableKey<T>)
+            i = details::hash64_batch_simd(begin, size, out, seed);
+
+        for (; i < size; ++i)
+            out[i] = hash64(begin[i], seed);
+
+        return out + size;
+    }
+} // namespace vt
+
+#endif
@@ -0,0 +1,160 @@
+#ifndef VARIADIC_TEMPLATES_STATIC_VECTOR_HPP
+#define VARIADIC_TEMPLATES_STATIC_VECTOR_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace vt
+{
+    /////////////////////////////////////////////////////////////////
+    // StaticVector - vector with inline storage for up to Capacity items
+    //
+    // Items are constructed in place in uninitialized storage inside the object,
+    // so there is no heap allocation and move-only types are supported.
+    //
+    template <typename T, size_t Capacity>
+    class StaticVector
+    {
+        alignas(T) std::byte storage_[(Capacity > 0 ? Capacity : 1) * sizeof(T)];
+        size_t size_{};
+
+    public:
+        using value_type = T;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+        StaticVector() = default;
+
+        StaticVector(const StaticVector& other)
+            requires std::is_copy_constructible_v<T>
+        {
+            for (const auto& item : other)
+                emplace_back(item);
+        }
+
+        StaticVector(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            for (auto& item : other)
+                emplace_back(std::move(item));
+        }
+
+        StaticVector& operator=(const StaticVector& other)
+            requires std::is_copy_constructible_v<T>
+        {
+            if (this != &other)
+            {
+                clear();
+                for (const auto& item : other)
+                    emplace_back(item);
+            }
+            return *this;
+        }
+
+        StaticVector& operator=(StaticVector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        {
+            if (this != &other)
+            {
+                clear();
+                for (auto& item : other)
+                    emplace_back(std::move(item));
+            }
+            return *this;
+        }
+
+        ~StaticVector()
+        {
+            clear();
+        }
+
+        template <typename... TArgs>
+        T& emplace_back(TArgs&&... args)
+        {
+            if (size_ == Capacity)
+                throw std::length_error("StaticVector capacity exceeded");
+
+            T* item = ::new (storage_ + size_ * sizeof(T)) T(std::forward<TArgs>(args)...);
+            ++size_;
+            return *item;
+        }
+
+        void push_back(const T& item)
+        {
+            emplace_back(item);
+        }
+
+        void push_back(T&& item)
+        {
+            emplace_back(std::move(item));
+        }
+
+        void clear() noexcept
+        {
+            std::destroy(begin(), end());
+            size_ = 0;
+        }
+
+        T* data() noexcept
+        {
+            return std::launder(reinterpret_cast<T*>(storage_));
+        }
+
+        const T* data() const noexcept
+        {
+            return std::launder(reinterpret_cast<const T*>(storage_));
+        }
+
+        size_t size() const noexcept
+        {
+            return size_;
+        }
+
+        static constexpr size_t capacity() noexcept
+        {
+            return Capacity;
+        }
+
+        bool empty() const noexcept
+        {
+            return size_ == 0;
+        }
+
+        T& operator[](size_t index)
+        {
+            assert(index < size_);
+            return data()[index];
+        }
+
+        const T& operator[](size_t index) const
+        {
+            assert(index < size_);
+            return data()[index];
+        }
+
+        iterator begin() noexcept
+        {
+            return data();
+        }
+
+        iterator end() noexcept
+        {
+            return data() + size_;
+        }
+
+        const_iterator begin() const noexcept
+        {
+            return data();
+        }
+
+        const_iterator end() const noexcept
+        {
+            return data() + size_;
+        }
+    };
+} // namespace vt
+
+#endif
@@ -1,10 +1,35 @@
+#include "allocation_counter.hpp"
+#include "execution.hpp"
+#include "hash64.hpp"
+#include "static_vector.hpp"
+#include "unroll.hpp"
+
 #include <algorithm>
+#include <array>
+#include <atomic>
 #include <cassert>
 #include <catch2/benchmark/catch_benchmark.hpp>
 #include <catch2/catch_approx.hpp>
 #include <catch2/catch_test_macros.hpp>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <initializer_list>
 #include <iostream>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
 #include <type_traits>
+#include <unordered_set>
+#include <utility>
+#include <variant>
 
 using namespace std;
 
@@ -66,6 +91,246 @@ TEST_CASE("variadic sum")
     }
 }
 
+///////////////////////////////////////////////
+// tree_sum - pairwise (balanced tree) fold
+
+namespace vt
+{
+    namespace details
+    {
+        template <size_t First, size_t Count, typename Tpl>
+        constexpr auto tree_sum_range(const Tpl& values)
+        {
+            if constexpr (Count == 1)
+                return std::get<First>(values);
+            else
+                return tree_sum_range<First, Count / 2>(values) + tree_sum_range<First + Count / 2, Count - Count / 2>(values);
+        }
+    } // namespace details
+
+    // the pack is split in halves recursively - ((v0 + v1) + (v2 + v3)) instead of (((v0 + v1) + v2) + v3),
+    // so independent adds can run in parallel (depth log2(N) instead of N) and rounding errors grow slower
+    // unlike vt::sum every pair of neighbours is added on its own - it is meant for types whose operator+ is
+    // closed (numbers, std::string) and tree_sum("a", s, "b", "c") does not compile ("b" + "c" are two pointers)
+    template <typename... Ts>
+    constexpr auto tree_sum(Ts... values)
+    {
+        static_assert(sizeof...(Ts) > 0, "tree_sum requires at least one value");
+
+        return details::tree_sum_range<0, sizeof...(Ts)>(std::forward_as_tuple(values...));
+    }
+} // namespace vt
+
+TEST_CASE("tree_sum")
+{
+    SECTION("same result as vt::sum for a closed operator+")
+    {
+        static_assert(vt::tree_sum(1, 2, 3, 4, 5, 6, 7) == 28);
+
+        auto sum = vt::tree_sum(1, 3, 3);
+        REQUIRE(sum == 7);
+        static_assert(is_same<int, decltype(sum)>::value, "Error");
+
+        auto dbl_sum = vt::tree_sum(1.1, 3.0f, 3);
+        REQUIRE(dbl_sum == Catch::Approx(7.1));
+        static_assert(is_same<double, decltype(dbl_sum)>::value, "Error");
+
+        auto text = vt::tree_sum(string("Hello"), string("world"), string("!"));
+        REQUIRE(text == "Helloworld!");
+        static_assert(is_same<string, decltype(text)>::value, "Error");
+    }
+
+    SECTION("single value")
+    {
+        REQUIRE(vt::tree_sum(42) == 42);
+    }
+
+    SECTION("smaller rounding error")
+    {
+        const double big = 9007199254740992.0; // 2^53 - big + 1.0 rounds back to big
+
+        REQUIRE(vt::sum(big, 1.0, 1.0, 1.0) == big);
+        REQUIRE(vt::tree_sum(big, 1.0, 1.0, 1.0) == big + 2.0);
+    }
+}
+
+namespace
+{
+    template <typename TSum, size_t N, size_t... Is>
+    double sum_of(TSum sum, const std::array<double, N>& values, std::index_sequence<Is...>)
+    {
+        return sum(values[Is]...);
+    }
+
+    template <size_t N>
+    void benchmark_sums(const std::vector<double>& data)
+    {
+        std::array<double, N> values;
+        std::copy_n(data.begin(), N, values.begin());
+
+        BENCHMARK("vt::sum - " + std::to_string(N) + " doubles")
+        {
+            return sum_of([](auto... v) { return vt::sum(v...); }, values, std::make_index_sequence<N>{});
+        };
+
+        BENCHMARK("vt::tree_sum - " + std::to_string(N) + " doubles")
+        {
+            return sum_of([](auto... v) { return vt::tree_sum(v...); }, values, std::make_index_sequence<N>{});
+        };
+    }
+} // namespace
+
+TEST_CASE("tree_sum vs. left fold", "[.][benchmark]")
+{
+    std::mt19937_64 rnd{665};
+    std::vector<double> data(64);
+    std::generate(data.begin(), data.end(), [&] { return std::uniform_real_distribution<double>(-1.0, 1.0)(rnd); });
+
+    benchmark_sums<8>(data);
+    benchmark_sums<16>(data);
+    benchmark_sums<32>(data);
+    benchmark_sums<64>(data);
+}
+
+///////////////////////////////////////////////
+// concat - string concatenation with a single allocation
+
+namespace vt
+{
+    namespace details
+    {
+        // number formatted on the stack - long enough for any integer and the shortest form of a double
+        struct FormattedNumber
+        {
+            char buffer[32];
+            size_t length;
+
+            FormattedNumber(std::integral auto value)
+                : length{static_cast<size_t>(std::to_chars(std::begin(buffer), std::end(buffer), value).ptr - buffer)}
+            { }
+
+            FormattedNumber(std::floating_point auto value)
+                : length{static_cast<size_t>(std::to_chars(std::begin(buffer), std::end(buffer), value).ptr - buffer)}
+            { }
+
+            std::string_view view() const
+            {
+                return {buffer, length};
+            }
+        };
+
+        // for string literals the length is folded to a constant by the compiler
+        inline std::string_view to_piece(const char* text)
+        {
+            return text;
+        }
+
+        inline std::string_view to_piece(std::string_view text)
+        {
+            return text;
+        }
+
+        inline std::string_view to_piece(const std::string& text)
+        {
+            return text;
+        }
+
+        inline std::string_view to_piece(const char& c)
+        {
+            return {&c, 1};
+        }
+
+        template <typename T>
+            requires(std::integral<T> || std::floating_point<T>) && (!std::same_as<T, bool>) && (!std::same_as<T, char>)
+        FormattedNumber to_piece(T value)
+        {
+            return FormattedNumber{value};
+        }
+
+        inline std::string_view view(std::string_view piece)
+        {
+            return piece;
+        }
+
+        inline std::string_view view(const FormattedNumber& piece)
+        {
+            return piece.view();
+        }
+    } // namespace details
+
+    // every piece is measured (numbers are formatted with to_chars into stack buffers) before
+    // the result is allocated once and each piece is copied into it exactly once
+    template <typename... Ts>
+    std::string concat(const Ts&... args)
+    {
+        const std::tuple pieces{details::to_piece(args)...};
+
+        return std::apply([](const auto&... piece) {
+            std::string result;
+            result.reserve((details::view(piece).size() + ... + 0));
+            (result.append(details::view(piece)), ...);
+            return result;
+        }, pieces);
+    }
+} // namespace vt
+
+TEST_CASE("concat")
+{
+    SECTION("strings")
+    {
+        REQUIRE(vt::concat("Hello", string("world"), "!") == "Helloworld!");
+        REQUIRE(vt::concat() == "");
+    }
+
+    SECTION("all kinds of pieces")
+    {
+        const char* ptr = "ptr";
+        std::string_view sv = "view";
+        char c = '#';
+
+        REQUIRE(vt::concat(ptr, ' ', sv, c, 42, ' ', -7L, ' ', 3.5, ' ', 0.1f, ' ', 255u) == "ptr view#42 -7 3.5 0.1 255");
+    }
+
+    SECTION("single allocation")
+    {
+        const std::string world = "world, this text is longer than any small string buffer";
+        std::string result;
+
+        REQUIRE(count_allocations([&] { result = vt::concat("Hello ", world, "! ", 2023, " ", 11.06); }) == 1);
+        REQUIRE(result == "Hello world, this text is longer than any small string buffer! 2023 11.06");
+
+        REQUIRE(count_allocations([&] { result = vt::sum("Hello ", world, "! ", "2023", " ", "11.06"); }) > 1);
+    }
+}
+
+TEST_CASE("concat vs. vt::sum vs. ostringstream", "[.][benchmark]")
+{
+    const std::string first_name = "Bjarne";
+    const std::string last_name = "Stroustrup";
+
+    BENCHMARK("vt::sum")
+    {
+        return vt::sum("First name: ", first_name, ", last name: ", last_name, ", language: ", "C++", "!");
+    };
+
+    BENCHMARK("vt::concat")
+    {
+        return vt::concat("First name: ", first_name, ", last name: ", last_name, ", language: ", "C++", "!");
+    };
+
+    BENCHMARK("ostringstream - with numbers")
+    {
+        std::ostringstream out;
+        out << "Name: " << first_name << " " << last_name << ", born: " << 1950 << ", score: " << 99.5;
+        return out.str();
+    };
+
+    BENCHMARK("vt::concat - with numbers")
+    {
+        return vt::concat("Name: ", first_name, " ", last_name, ", born: ", 1950, ", score: ", 99.5);
+    };
+}
+
 ///////////////////////////////////////////////
 
 namespace vt
@@ -86,6 +351,242 @@ TEST_CASE("select for tuple")
     REQUIRE(vt::select<3, 2, 1, 0>(row) == std::make_tuple(std::vector{1, 2, 3}, "last-name", "first-name", 1));
 }
 
+namespace vt
+{
+    namespace details
+    {
+        // result for the first item as std::get returns it (const for a const tuple)
+        template <typename Tpl, typename F>
+        using VisitResult_t = std::invoke_result_t<F&, decltype(std::get<0>(std::declval<Tpl&>()))>;
+
+        // table[I] - calls f with I-th item of the tuple (items of const tuple are const)
+        template <typename Tpl, typename F, size_t... Indexes>
+        constexpr auto make_visit_table(std::index_sequence<Indexes...>)
+        {
+            using TResult = VisitResult_t<Tpl, F>;
+            using TFunction = TResult (*)(Tpl&, F&);
+
+            static_assert((std::is_same_v<TResult, std::invoke_result_t<F&, decltype(std::get<Indexes>(std::declval<Tpl&>()))>> && ...),
+                "visitor must return the same type for every element");
+
+            return std::array<TFunction, sizeof...(Indexes)>{[](Tpl& tpl, F& f) -> TResult { return f(std::get<Indexes>(tpl)); }...};
+        }
+
+        template <typename TVariant, typename Tpl, size_t... Indexes>
+        constexpr auto make_select_table(std::index_sequence<Indexes...>)
+        {
+            using TFunction = TVariant (*)(const Tpl&);
+
+            return std::array<TFunction, sizeof...(Indexes)>{[](const Tpl& tpl) { return TVariant{std::in_place_index<Indexes>, std::get<Indexes>(tpl)}; }...};
+        }
+
+        template <typename Tpl>
+        struct VariantOf;
+
+        template <typename... Ts>
+        struct VariantOf<std::tuple<Ts...>>
+        {
+            using type = std::variant<Ts...>;
+        };
+    } // namespace details
+
+    // f(std::get<index>(tpl)) - O(1) dispatch through a constexpr table of function pointers;
+    // f must return the same type for every item (as in std::visit)
+    template <typename Tpl, typename F>
+    decltype(auto) visit_at(Tpl& tpl, size_t index, F&& f)
+    {
+        constexpr size_t size = std::tuple_size_v<std::remove_const_t<Tpl>>;
+        static_assert(size > 0, "visit_at requires a non-empty tuple");
+
+        static constexpr auto table = details::make_visit_table<Tpl, std::remove_reference_t<F>>(std::make_index_sequence<size>{});
+
+        if (index >= size)
+            throw std::out_of_range("tuple index out of range");
+
+        return table[index](tpl, f);
+    }
+
+    // copies of the selected items - the i-th variant holds the alternative with index indexes[i]
+    template <size_t Capacity = 16, typename... Ts>
+    auto select_runtime(const std::tuple<Ts...>& tpl, std::span<const size_t> indexes)
+    {
+        using TVariant = std::variant<Ts...>;
+        static constexpr auto table = details::make_select_table<TVariant, std::tuple<Ts...>>(std::index_sequence_for<Ts...>{});
+
+        StaticVector<TVariant, Capacity> selected;
+
+        for (size_t index : indexes)
+        {
+            if (index >= sizeof...(Ts))
+                throw std::out_of_range("tuple index out of range");
+
+            selected.push_back(table[index](tpl));
+        }
+
+        return selected;
+    }
+
+    template <size_t Capacity = 16, typename... Ts>
+    auto select_runtime(const std::tuple<Ts...>& tpl, std::initializer_list<size_t> indexes)
+    {
+        return select_runtime<Capacity>(tpl, std::span{indexes.begin(), indexes.size()});
+    }
+} // namespace vt
+
+namespace
+{
+    // returns a different type for const items
+    struct Constness
+    {
+        std::string operator()(auto&) const
+        {
+            return "mutable";
+        }
+
+        const char* operator()(const auto&) const
+        {
+            return "const";
+        }
+    };
+} // namespace
+
+TEST_CASE("visit_at - runtime index")
+{
+    std::tuple<int, std::string, double> row{1, "text", 3.14};
+
+    auto to_string = [](const auto& item) {
+        std::ostringstream out;
+        out << item;
+        return out.str();
+    };
+
+    REQUIRE(vt::visit_at(row, 0, to_string) == "1");
+    REQUIRE(vt::visit_at(row, 1, to_string) == "text");
+    REQUIRE(vt::visit_at(row, 2, to_string) == "3.14");
+    REQUIRE_THROWS_AS(vt::visit_at(row, 3, to_string), std::out_of_range);
+
+    SECTION("items can be modified")
+    {
+        vt::visit_at(row, 1, [](auto& item) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(item)>, std::string>)
+                item += "!";
+        });
+
+        REQUIRE(std::get<1>(row) == "text!");
+    }
+
+    SECTION("const tuple")
+    {
+        const auto& const_row = row;
+
+        REQUIRE(vt::visit_at(const_row, 0, [](auto& item) { return std::is_const_v<std::remove_reference_t<decltype(item)>>; }));
+    }
+
+    SECTION("mixed-type tuple with a common result type")
+    {
+        std::tuple<int, double> numbers{1, 3.75};
+
+        auto as_double = [](auto value) -> double { return value; };
+
+        REQUIRE(vt::visit_at(numbers, 0, as_double) == 1.0);
+        REQUIRE(vt::visit_at(numbers, 1, as_double) == 3.75);
+    }
+
+    SECTION("result type follows constness of items")
+    {
+        const auto& const_row = row;
+
+        STATIC_REQUIRE(std::is_same_v<decltype(vt::visit_at(row, 0, Constness{})), std::string>);
+        STATIC_REQUIRE(std::is_same_v<decltype(vt::visit_at(const_row, 0, Constness{})), const char*>);
+        REQUIRE(vt::visit_at(const_row, 2, Constness{}) == "const"sv);
+    }
+}
+
+TEST_CASE("select_runtime")
+{
+    std::tuple<int, std::string, std::string, double> row{1, "first-name", "last-name", 2.5};
+
+    auto selected = vt::select_runtime(row, {3, 2, 0, 2});
+
+    REQUIRE(selected.size() == 4);
+    REQUIRE(std::get<3>(selected[0]) == 2.5);
+    REQUIRE(selected[1].index() == 2);
+    REQUIRE(std::get<2>(selected[1]) == "last-name");
+    REQUIRE(std::get<0>(selected[2]) == 1);
+
+    const std::vector<size_t> query = {1};
+    REQUIRE(std::get<1>(vt::select_runtime(row, query)[0]) == "first-name");
+
+    REQUIRE_THROWS_AS(vt::select_runtime(row, {4}), std::out_of_range);
+    REQUIRE_THROWS_AS(vt::select_runtime<2>(row, {0, 1, 2}), std::length_error);
+}
+
+namespace
+{
+    // nested ifs - what the jump table replaces
+    template <size_t Index = 0, typename Tpl, typename F>
+    auto visit_at_chained_if(const Tpl& tpl, size_t index, F&& f)
+    {
+        if constexpr (Index + 1 == std::tuple_size_v<Tpl>)
+            return f(std::get<Index>(tpl));
+        else
+        {
+            if (index == Index)
+                return f(std::get<Index>(tpl));
+            return visit_at_chained_if<Index + 1>(tpl, index, f);
+        }
+    }
+
+    template <size_t Index>
+    auto column_value()
+    {
+        if constexpr (Index % 2 == 0)
+            return static_cast<int>(Index);
+        else
+            return static_cast<double>(Index);
+    }
+
+    template <size_t... Indexes>
+    auto make_row(std::index_sequence<Indexes...>)
+    {
+        return std::tuple{column_value<Indexes>()...};
+    }
+
+    template <size_t Size>
+    void benchmark_visit(const std::vector<size_t>& queries)
+    {
+        const auto row = make_row(std::make_index_sequence<Size>{});
+        auto to_double = [](auto value) { return static_cast<double>(value); };
+
+        BENCHMARK("chained if - " + std::to_string(Size) + " columns")
+        {
+            double total = 0.0;
+            for (size_t query : queries)
+                total += visit_at_chained_if(row, query % Size, to_double);
+            return total;
+        };
+
+        BENCHMARK("visit_at - " + std::to_string(Size) + " columns")
+        {
+            double total = 0.0;
+            for (size_t query : queries)
+                total += vt::visit_at(row, query % Size, to_double);
+            return total;
+        };
+    }
+} // namespace
+
+TEST_CASE("visit_at vs. chained if", "[.][benchmark]")
+{
+    std::mt19937_64 rnd{665};
+    std::vector<size_t> queries(4'096);
+    std::generate(queries.begin(), queries.end(), std::ref(rnd));
+
+    benchmark_visit<4>(queries);
+    benchmark_visit<16>(queries);
+    benchmark_visit<64>(queries);
+}
+
 /////////////////////////////////////////////////
 
 namespace vt
@@ -121,45 +622,407 @@ TEST_CASE("call_n_times wrapper")
     using Indexes = std::make_index_sequence<N>;
 }
 
-///////////////////////////////////////////////
-
 namespace vt
 {
-    // TODO - make_vector function that creates vector from a list of arguments
-    // Tip: use std::common_type_t<Ts...> trait
-    template <typename... T>
-    auto make_vector(T&&... args)
+    // the loop is unrolled at compile time - func is called as func(index, args...),
+    // where index is std::integral_constant<size_t, I> (usable in constant expressions)
+    template <size_t Count, typename F, typename... Args>
+    void call_n_times_unrolled(const F& func, const Args&... args)
     {
-        std::vector<std::common_type_t<T...>> vec;
-        vec.reserve(sizeof...(args));
+        unroll<Count>([&](auto index) { func(index, args...); });
+    }
 
-        (vec.push_back(std::forward<T>(args)), ...);
-        return vec;
+    // func must be thread-safe - Count calls are split into chunks run concurrently by ExecutionPolicy,
+    // the first exception thrown by func is rethrown after all chunks finished
+    template <size_t Count, typename ExecutionPolicy = ThreadPoolExecution, typename F, typename... Args>
+    void call_n_times_parallel(const F& func, const Args&... args)
+    {
+        const size_t chunk_count = std::min(Count, ExecutionPolicy::chunk_count());
+
+        if (chunk_count == 0)
+            return;
+
+        ExecutionPolicy::run(chunk_count, [&](size_t chunk) {
+            const size_t first = Count * chunk / chunk_count;
+            const size_t last = Count * (chunk + 1) / chunk_count;
+
+            for (size_t i = first; i < last; ++i)
+                func(args...);
+        });
     }
 } // namespace vt
 
-TEST_CASE("make_vector - create vector from a list of arguments")
+TEST_CASE("call_n_times - unrolled")
 {
-    // const std::vector<std::unique_ptr<int>> vec = { std::make_unique<int>(13) };
+    std::vector<std::tuple<size_t, int, std::string>> results;
 
-    SECTION("ints")
+    vt::call_n_times_unrolled<5>([&results](auto index, int value, const std::string& text) { results.emplace_back(index, value, text); }, 1, "one"s);
+
+    REQUIRE(results.size() == 5);
+    for (size_t i = 0; i < results.size(); ++i)
+        REQUIRE(results[i] == std::make_tuple(i, 1, "one"s));
+
+    std::array<int, 4> squares{};
+    vt::call_n_times_unrolled<4>([&squares](auto index) { std::get<index>(squares) = index * index; });
+    REQUIRE(squares == std::array{0, 1, 4, 9});
+}
+
+TEST_CASE("call_n_times - parallel")
+{
+    std::atomic<int> counter{};
+    std::atomic<int> sum{};
+
+    auto func = [&](int value) {
+        ++counter;
+        sum += value;
+    };
+
+    SECTION("many calls")
     {
-        std::vector<double> v = vt::make_vector(1, 2.0, 3);
+        vt::call_n_times_parallel<1'000>(func, 2);
 
-        REQUIRE(v == vector{1.0, 2.0, 3.0});
+        REQUIRE(counter == 1'000);
+        REQUIRE(sum == 2'000);
     }
 
-    SECTION("unique_ptrs")
+    SECTION("fewer calls than threads")
     {
-        auto ptrs = vt::make_vector(make_unique<int>(5), make_unique<int>(6));
+        vt::call_n_times_parallel<1>(func, 2);
+        vt::call_n_times_parallel<0>(func, 2);
 
-        REQUIRE(ptrs.size() == 2);
-        REQUIRE(*ptrs[0] == 5);
-        REQUIRE(*ptrs[1] == 6);
+        REQUIRE(counter == 1);
     }
-}
 
-/////////////////////////////////////////////////////////////////////////////////////////////////
+    SECTION("exception is propagated")
+    {
+        REQUIRE_THROWS_AS(vt::call_n_times_parallel<10>([](int) { throw std::runtime_error("error"); }, 1), std::runtime_error);
+    }
+
+    SECTION("exception is propagated from a chunked thread")
+    {
+        auto throw_once = [&](int value) {
+            if (++counter == 3)
+                throw std::runtime_error("error");
+            sum += value;
+        };
+
+        REQUIRE_THROWS_AS((vt::call_n_times_parallel<12, ChunkedParallelExecution<4>>(throw_once, 1)), std::runtime_error);
+        REQUIRE(counter >= 3);
+    }
+}
+
+namespace
+{
+    double heavy_work(int seed)
+    {
+        double result = seed;
+        for (int i = 0; i < 100'000; ++i)
+            result = std::sqrt(result + i);
+        return result;
+    }
+} // namespace
+
+TEST_CASE("call_n_times - loop vs. unrolled vs. parallel", "[.][benchmark]")
+{
+    int counter = 0;
+    auto tiny = [&counter](int value) { counter += value; };
+    auto tiny_indexed = [&counter](auto, int value) { counter += value; };
+
+    BENCHMARK("tiny body - loop")
+    {
+        vt::call_n_times<64>(tiny, 1);
+        return counter;
+    };
+
+    BENCHMARK("tiny body - unrolled")
+    {
+        vt::call_n_times_unrolled<64>(tiny_indexed, 1);
+        return counter;
+    };
+
+    std::atomic<int> atomic_counter{};
+
+    BENCHMARK("tiny body - parallel")
+    {
+        vt::call_n_times_parallel<64>([&atomic_counter](int value) { atomic_counter += value; }, 1);
+        return atomic_counter.load();
+    };
+
+    std::atomic<double> total{};
+    auto heavy = [&total](int seed) {
+        const double result = heavy_work(seed);
+        double expected = total.load();
+        while (!total.compare_exchange_weak(expected, expected + result))
+        { }
+    };
+
+    BENCHMARK("heavy body - loop")
+    {
+        vt::call_n_times<64>(heavy, 1);
+        return total.load();
+    };
+
+    BENCHMARK("heavy body - unrolled")
+    {
+        vt::call_n_times_unrolled<64>([&heavy](auto, int seed) { heavy(seed); }, 1);
+        return total.load();
+    };
+
+    BENCHMARK("heavy body - parallel")
+    {
+        vt::call_n_times_parallel<64>(heavy, 1);
+        return total.load();
+    };
+}
+
+///////////////////////////////////////////////
+
+namespace vt
+{
+    namespace details
+    {
+        // explicitly given element type or the common type of arguments
+        template <typename T, typename... Ts>
+        struct ElementType
+        {
+            using type = T;
+        };
+
+        template <typename... Ts>
+        struct ElementType<void, Ts...> : std::common_type<Ts...>
+        { };
+
+        template <typename T, typename... Ts>
+        using ElementType_t = typename ElementType<T, Ts...>::type;
+    } // namespace details
+
+    template <typename T>
+    concept Allocator = requires(T alloc, size_t n) {
+        typename T::value_type;
+        alloc.allocate(n);
+    };
+
+    // TODO - make_vector function that creates vector from a list of arguments
+    // Tip: use std::common_type_t<Ts...> trait
+    //
+    // every element is constructed in place from its argument (emplace_back) - there is no
+    // temporary of the element type; the allocator is rebound to the element type
+    template <Allocator Alloc, typename... Ts>
+    auto make_vector(std::allocator_arg_t, const Alloc& alloc, Ts&&... args)
+    {
+        using TElement = details::ElementType_t<void, Ts...>;
+        using TAlloc = typename std::allocator_traits<Alloc>::template rebind_alloc<TElement>;
+
+        std::vector<TElement, TAlloc> vec(TAlloc{alloc});
+        vec.reserve(sizeof...(args));
+
+        (vec.emplace_back(std::forward<Ts>(args)), ...);
+        return vec;
+    }
+
+    template <Allocator Alloc, typename... Ts>
+    auto make_vector(Ts&&... args)
+    {
+        return make_vector(std::allocator_arg, Alloc{}, std::forward<Ts>(args)...);
+    }
+
+    template <typename T = void, typename... Ts>
+        requires(!Allocator<T>)
+    auto make_vector(Ts&&... args) -> std::vector<details::ElementType_t<T, Ts...>>
+    {
+        std::vector<details::ElementType_t<T, Ts...>> vec;
+        vec.reserve(sizeof...(args));
+
+        (vec.emplace_back(std::forward<Ts>(args)), ...);
+        return vec;
+    }
+
+    // every element is initialized directly from a prvalue (guaranteed copy elision)
+    template <typename T = void, typename... Ts>
+    constexpr auto make_array(Ts&&... args) -> std::array<details::ElementType_t<T, Ts...>, sizeof...(Ts)>
+    {
+        using TElement = details::ElementType_t<T, Ts...>;
+
+        return {TElement(std::forward<Ts>(args))...};
+    }
+
+    // capacity is the number of arguments or Capacity - whichever is bigger
+    template <size_t Capacity = 0, typename... Ts>
+    auto make_static_vector(Ts&&... args)
+    {
+        using TElement = details::ElementType_t<void, Ts...>;
+
+        StaticVector<TElement, std::max(Capacity, sizeof...(Ts))> vec;
+        (vec.emplace_back(std::forward<Ts>(args)), ...);
+        return vec;
+    }
+} // namespace vt
+
+namespace
+{
+    // counts copies & moves
+    struct Tracked
+    {
+        inline static int copies = 0;
+        inline static int moves = 0;
+
+        int value;
+
+        Tracked(int value)
+            : value{value}
+        { }
+
+        Tracked(const Tracked& other)
+            : value{other.value}
+        {
+            ++copies;
+        }
+
+        Tracked(Tracked&& other) noexcept
+            : value{other.value}
+        {
+            ++moves;
+        }
+
+        static void reset()
+        {
+            copies = moves = 0;
+        }
+    };
+} // namespace
+
+TEST_CASE("make_vector - create vector from a list of arguments")
+{
+    // const std::vector<std::unique_ptr<int>> vec = { std::make_unique<int>(13) };
+
+    SECTION("ints")
+    {
+        std::vector<double> v = vt::make_vector(1, 2.0, 3);
+
+        REQUIRE(v == vector{1.0, 2.0, 3.0});
+    }
+
+    SECTION("unique_ptrs")
+    {
+        auto ptrs = vt::make_vector(make_unique<int>(5), make_unique<int>(6));
+
+        REQUIRE(ptrs.size() == 2);
+        REQUIRE(*ptrs[0] == 5);
+        REQUIRE(*ptrs[1] == 6);
+    }
+
+    SECTION("explicit element type")
+    {
+        auto texts = vt::make_vector<std::string>("one", "two"sv, "three"s);
+
+        REQUIRE(texts == std::vector<std::string>{"one", "two", "three"});
+    }
+
+    SECTION("allocator")
+    {
+        std::array<std::byte, 1024> arena;
+        std::pmr::monotonic_buffer_resource resource{arena.data(), arena.size(), std::pmr::null_memory_resource()};
+
+        std::pmr::vector<int> v = vt::make_vector(std::allocator_arg, std::pmr::polymorphic_allocator<>{&resource}, 1, 2, 3);
+        REQUIRE(v == std::pmr::vector<int>{1, 2, 3});
+        REQUIRE(v.get_allocator().resource() == &resource);
+
+        std::vector<long, std::allocator<long>> w = vt::make_vector<std::allocator<char>>(1, 2L);
+        REQUIRE(w == std::vector{1L, 2L});
+    }
+
+    SECTION("elements are constructed in place")
+    {
+        Tracked::reset();
+        auto v = vt::make_vector<Tracked>(1, 2, 3);
+
+        REQUIRE(v.size() == 3);
+        REQUIRE(Tracked::copies + Tracked::moves == 0);
+
+        Tracked::reset();
+        auto w = vt::make_vector(Tracked{1}, Tracked{2});
+
+        REQUIRE(Tracked::copies == 0);
+        REQUIRE(Tracked::moves == 2); // from the arguments only
+    }
+}
+
+TEST_CASE("make_array")
+{
+    constexpr auto numbers = vt::make_array(1, 2.0, 3);
+    static_assert(std::is_same_v<decltype(numbers), const std::array<double, 3>>);
+    static_assert(numbers[2] == 3.0);
+
+    auto ptrs = vt::make_array(make_unique<int>(5), make_unique<int>(6));
+    REQUIRE(*ptrs[1] == 6);
+
+    Tracked::reset();
+    auto tracked = vt::make_array<Tracked>(1, 2, 3);
+    REQUIRE(tracked[2].value == 3);
+    REQUIRE(Tracked::copies + Tracked::moves == 0);
+}
+
+TEST_CASE("make_static_vector")
+{
+    auto ptrs = vt::make_static_vector(make_unique<int>(5), make_unique<int>(6));
+    static_assert(decltype(ptrs)::capacity() == 2);
+    REQUIRE(ptrs.size() == 2);
+    REQUIRE(*ptrs[0] == 5);
+
+    auto numbers = vt::make_static_vector<8>(1, 2, 3);
+    numbers.push_back(4);
+    REQUIRE(std::vector(numbers.begin(), numbers.end()) == std::vector{1, 2, 3, 4});
+    REQUIRE(numbers.capacity() == 8);
+
+    auto full = vt::make_static_vector(1, 2);
+    REQUIRE_THROWS_AS(full.push_back(3), std::length_error);
+
+    REQUIRE(count_allocations([] { return vt::make_static_vector(1, 2, 3, 4).size(); }) == 0);
+}
+
+TEST_CASE("make_vector - many small vectors", "[.][benchmark]")
+{
+    const size_t count = 10'000;
+
+    BENCHMARK("make_vector - std::allocator")
+    {
+        int total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += vt::make_vector(1, 2, 3, 4).back();
+        return total;
+    };
+
+    std::vector<std::byte> arena(count * 4 * sizeof(int) * 2);
+
+    BENCHMARK("make_vector - pmr arena")
+    {
+        std::pmr::monotonic_buffer_resource resource{arena.data(), arena.size()};
+        std::pmr::polymorphic_allocator<> alloc{&resource};
+
+        int total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += vt::make_vector(std::allocator_arg, alloc, 1, 2, 3, 4).back();
+        return total;
+    };
+
+    BENCHMARK("make_static_vector")
+    {
+        int total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += vt::make_static_vector(1, 2, 3, 4)[3];
+        return total;
+    };
+
+    BENCHMARK("make_array")
+    {
+        int total = 0;
+        for (size_t i = 0; i < count; ++i)
+            total += vt::make_array(1, 2, 3, 4)[3];
+        return total;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace vt
 {
@@ -192,12 +1055,219 @@ TEST_CASE("combined_hash - write a function that calculates combined hash value
     CHECK(vt::combined_hash(1, 3.14, "string"s) == 2865319663);
     CHECK(vt::combined_hash(123L, "abc"sv, 234, 3.14f) == 1326321790);
 #else
-    CHECK(combined_hash(1U) == 2654435770U);
-    CHECK(combined_hash(1, 3.14, "string"s) == 10365827363824479057U);
-    CHECK(combined_hash(123L, "abc"sv, 234, 3.14f) == 162170636579575197U);
+    CHECK(vt::combined_hash(1U) == 2654435770U);
+    CHECK(vt::combined_hash(1, 3.14, "string"s) == 2680695633U);
+    CHECK(vt::combined_hash(123L, "abc"sv, 234, 3.14f) == 575870365U);
 #endif
 }
 
+TEST_CASE("hash64 - equal values give equal hashes")
+{
+    const std::string text = "text";
+
+    CHECK(vt::hash64(text) == vt::hash64("text"sv));
+    CHECK(vt::hash64(text) == vt::hash64("text"));
+    CHECK(vt::hash64(text) == vt::hash64(text.c_str()));
+    CHECK(vt::hash64(0.0) == vt::hash64(-0.0));
+    CHECK(vt::hash64(std::vector{1, 2, 3}) == vt::hash64(std::array{1, 2, 3}));
+
+    CHECK(vt::combined_hash64(1, 3.14, "string"s) == vt::hash64(std::tuple{1, 3.14, "string"s}));
+    CHECK(vt::combined_hash64(1, "one"s) == vt::hash64(std::pair{1, "one"s}));
+}
+
+TEST_CASE("hash64 - different values give different hashes")
+{
+    CHECK(vt::combined_hash64(1, 2) != vt::combined_hash64(2, 1));
+    CHECK(vt::hash64(42) != vt::hash64(42, 1)); // seed
+    CHECK(vt::hash64(0) != 0);
+
+    SECTION("strings of every length")
+    {
+        std::unordered_set<uint64_t> hashes;
+        for (size_t length = 0; length <= 256; ++length)
+            hashes.insert(vt::hash64(std::string(length, 'a')));
+
+        CHECK(hashes.size() == 257);
+    }
+
+    SECTION("no collisions where 32-bit combined_hash collides")
+    {
+        std::unordered_set<uint32_t> hashes32;
+        std::unordered_set<uint64_t> hashes64;
+        hashes32.reserve(1'000'000);
+        hashes64.reserve(1'000'000);
+
+        for (int i = 0; i < 1'000; ++i)
+            for (int j = 0; j < 1'000; ++j)
+            {
+                hashes32.insert(vt::combined_hash(i, j));
+                hashes64.insert(vt::combined_hash64(i, j));
+            }
+
+        CHECK(hashes32.size() < 1'000'000);
+        CHECK(hashes64.size() == 1'000'000);
+    }
+}
+
+namespace
+{
+    // chi-square statistic of 2^20 hashes of sequential keys distributed into 1024 buckets
+    template <typename FBucket>
+    double chi_square_of_sequential_keys(FBucket bucket_of)
+    {
+        const size_t bucket_count = 1024;
+        const size_t key_count = 1024 * bucket_count;
+
+        std::vector<size_t> buckets(bucket_count);
+        for (uint64_t key = 0; key < key_count; ++key)
+            ++buckets[bucket_of(vt::hash64(key))];
+
+        const double expected = static_cast<double>(key_count) / bucket_count;
+        double chi_square = 0.0;
+        for (size_t count : buckets)
+            chi_square += (count - expected) * (count - expected) / expected;
+
+        return chi_square;
+    }
+
+    // average number of output bits changed by flipping a single input bit
+    template <typename T, typename FMutate>
+    double avalanche(const std::vector<T>& keys, size_t bit_count, FMutate flip_bit)
+    {
+        size_t flipped_bits = 0;
+
+        for (const auto& key : keys)
+        {
+            const uint64_t hash = vt::hash64(key);
+
+            for (size_t bit = 0; bit < bit_count; ++bit)
+                flipped_bits += std::popcount(hash ^ vt::hash64(flip_bit(key, bit)));
+        }
+
+        return static_cast<double>(flipped_bits) / static_cast<double>(keys.size() * bit_count);
+    }
+} // namespace
+
+TEST_CASE("hash64 - distribution quality")
+{
+    SECTION("low and high bits are uniform for sequential keys")
+    {
+        // 1023 degrees of freedom - mean 1023, standard deviation ~45
+        CHECK(chi_square_of_sequential_keys([](uint64_t h) { return h & 1023; }) < 1'250.0);
+        CHECK(chi_square_of_sequential_keys([](uint64_t h) { return h >> 54; }) < 1'250.0);
+    }
+
+    SECTION("avalanche")
+    {
+        std::mt19937_64 rnd{665};
+
+        std::vector<uint64_t> integers(10'000);
+        std::generate(integers.begin(), integers.end(), std::ref(rnd));
+
+        const double integer_avalanche = avalanche(integers, 64, [](uint64_t key, size_t bit) { return key ^ (uint64_t{1} << bit); });
+        CHECK(integer_avalanche > 31.5);
+        CHECK(integer_avalanche < 32.5);
+
+        for (size_t length : {3, 8, 16, 40, 100})
+        {
+            std::vector<std::string> texts(1'000, std::string(length, ' '));
+            for (auto& text : texts)
+                std::generate(text.begin(), text.end(), [&] { return static_cast<char>(rnd()); });
+
+            const double text_avalanche = avalanche(texts, 8 * length, [](std::string text, size_t bit) {
+                text[bit / 8] ^= static_cast<char>(1 << (bit % 8));
+                return text;
+            });
+            CHECK(text_avalanche > 31.0);
+            CHECK(text_avalanche < 33.0);
+        }
+    }
+}
+
+namespace
+{
+    enum class Color : int32_t
+    {
+        red,
+        green,
+        blue
+    };
+
+    template <typename T>
+    void check_batch_matches_scalar(const std::vector<T>& keys)
+    {
+        std::vector<uint64_t> hashes(keys.size());
+
+        for (size_t size = 0; size <= keys.size(); ++size)
+        {
+            REQUIRE(vt::hash64_batch(keys.data(), keys.data() + size, hashes.data(), 13) == hashes.data() + size);
+
+            for (size_t i = 0; i < size; ++i)
+                REQUIRE(hashes[i] == vt::hash64(keys[i], 13));
+        }
+    }
+} // namespace
+
+TEST_CASE("hash64_batch - same values as hash64")
+{
+    check_batch_matches_scalar(std::vector<uint64_t>{0, 1, 2, ~0ull, 1ull << 63, 42, 665, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+    check_batch_matches_scalar(std::vector<int32_t>{0, -1, 1, INT32_MIN, INT32_MAX, 42, 665, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16});
+    check_batch_matches_scalar(std::vector<int64_t>{-1, -2, -3, 4, 5, 6, 7});
+    check_batch_matches_scalar(std::vector<Color>{Color::red, Color::green, Color::blue, Color::red, Color::blue});
+    check_batch_matches_scalar(std::vector<uint16_t>{1, 2, 3, 4, 5});
+    check_batch_matches_scalar(std::vector<std::string>{"a", "bb", "ccc", "a much longer text that takes the bulk path"});
+}
+
+TEST_CASE("hash64 vs. combined_hash", "[.][benchmark]")
+{
+    const size_t size = 1'000'000;
+
+    std::mt19937_64 rnd{665};
+    std::vector<uint64_t> keys(size);
+    std::generate(keys.begin(), keys.end(), std::ref(rnd));
+    std::vector<uint64_t> hashes(size);
+
+    std::vector<std::tuple<int, std::string>> rows;
+    for (size_t i = 0; i < 10'000; ++i)
+        rows.emplace_back(static_cast<int>(i), "row-" + std::to_string(i));
+
+    BENCHMARK("combined_hash - 10^6 integers")
+    {
+        for (size_t i = 0; i < size; ++i)
+            hashes[i] = vt::combined_hash(keys[i]);
+        return hashes.back();
+    };
+
+    BENCHMARK("hash64 - 10^6 integers")
+    {
+        for (size_t i = 0; i < size; ++i)
+            hashes[i] = vt::hash64(keys[i]);
+        return hashes.back();
+    };
+
+    BENCHMARK("hash64_batch - 10^6 integers")
+    {
+        vt::hash64_batch(keys.data(), keys.data() + size, hashes.data());
+        return hashes.back();
+    };
+
+    BENCHMARK("combined_hash - 10^4 rows (int, string)")
+    {
+        uint64_t result = 0;
+        for (const auto& [id, name] : rows)
+            result ^= vt::combined_hash(id, name);
+        return result;
+    };
+
+    BENCHMARK("combined_hash64 - 10^4 rows (int, string)")
+    {
+        uint64_t result = 0;
+        for (const auto& [id, name] : rows)
+            result ^= vt::combined_hash64(id, name);
+        return result;
+    };
+}
+
 /////////////////////////////////////////////////////////////////////
 // index_sequence
 
@@ -224,4 +1294,135 @@ TEST_CASE("tuple_apply")
     std::tuple tpl{1, 3.14, "text"s}; // 0, 1, 2
 
     vt::tuple_apply([](const auto& item) { std::cout << "item: " << item << "\n"; }, tpl);
-}
\ No newline at end of file
+}
+
+namespace vt
+{
+    namespace details
+    {
+        // void results are returned as std::monostate
+        template <typename F, typename T>
+        auto invoke_to_value(F& f, T& item)
+        {
+            if constexpr (std::is_void_v<std::invoke_result_t<F&, T&>>)
+            {
+                f(item);
+                return std::monostate{};
+            }
+            else
+                return f(item);
+        }
+
+        template <typename F, typename Tpl, size_t... Indexes>
+        auto parallel_tuple_apply_impl(F& f, Tpl& tpl, std::index_sequence<Indexes...>)
+        {
+            using TResult = std::tuple<decltype(invoke_to_value(f, std::get<Indexes>(tpl)))...>;
+
+            // a nested call from a task of the pool runs inline - its jobs could wait for a free worker forever
+            if (ThreadPool::instance().is_worker_thread())
+                return TResult{invoke_to_value(f, std::get<Indexes>(tpl))...}; // braced init - evaluated in order
+
+            auto futures = std::tuple{ThreadPool::instance().submit([&f, &tpl] { return invoke_to_value(f, std::get<Indexes>(tpl)); })...};
+
+            // every job must finish before f & tpl can go out of scope
+            (std::get<Indexes>(futures).wait(), ...);
+
+            return TResult{std::get<Indexes>(futures).get()...}; // braced init - exception of the lowest index is rethrown
+        }
+    } // namespace details
+
+    // fork-join: f(item) for all items runs concurrently on the shared thread pool;
+    // called from a task of the same pool, the items are processed sequentially on the calling worker
+    template <typename F, typename Tpl>
+    auto parallel_tuple_apply(F&& f, Tpl&& tpl)
+    {
+        return details::parallel_tuple_apply_impl(f, tpl, std::make_index_sequence<std::tuple_size_v<std::remove_cvref_t<Tpl>>>{});
+    }
+} // namespace vt
+
+TEST_CASE("parallel_tuple_apply")
+{
+    SECTION("tuple of results")
+    {
+        std::tuple jobs{21, "text"s, std::vector{1, 2, 3}};
+
+        auto results = vt::parallel_tuple_apply([](const auto& job) {
+            if constexpr (std::is_same_v<std::decay_t<decltype(job)>, int>)
+                return job * 2;
+            else if constexpr (std::is_same_v<std::decay_t<decltype(job)>, std::string>)
+                return job + "!";
+            else
+                return std::accumulate(job.begin(), job.end(), 0.0);
+        }, jobs);
+
+        static_assert(std::is_same_v<decltype(results), std::tuple<int, std::string, double>>);
+        REQUIRE(results == std::tuple{42, "text!"s, 6.0});
+    }
+
+    SECTION("items can be modified - void results")
+    {
+        std::tuple items{1, 2.5};
+
+        auto results = vt::parallel_tuple_apply([](auto& item) { item *= 2; }, items);
+
+        static_assert(std::is_same_v<decltype(results), std::tuple<std::monostate, std::monostate>>);
+        REQUIRE(items == std::tuple{2, 5.0});
+    }
+
+    SECTION("exception is propagated after all jobs are done")
+    {
+        std::atomic<int> done{};
+
+        auto job = [&done](int id) {
+            ++done;
+            if (id % 2 == 1)
+                throw std::runtime_error("job " + std::to_string(id));
+            return id;
+        };
+
+        REQUIRE_THROWS_WITH(vt::parallel_tuple_apply(job, std::tuple{0, 1, 2, 3}), "job 1");
+        REQUIRE(done == 4);
+    }
+
+    SECTION("nested call from a task of the pool runs inline")
+    {
+        auto outer = ThreadPool::instance().submit([] {
+            return vt::parallel_tuple_apply([](int item) { return item * 2; }, std::tuple{1, 2, 3});
+        });
+
+        REQUIRE(outer.get() == std::tuple{2, 4, 6});
+    }
+}
+
+namespace
+{
+    // job of a given size
+    struct Job
+    {
+        int iterations;
+
+        double operator()() const
+        {
+            double result = 0.0;
+            for (int i = 0; i < iterations; ++i)
+                result = std::sqrt(result + i);
+            return result;
+        }
+    };
+} // namespace
+
+TEST_CASE("tuple_apply vs. parallel_tuple_apply - unequal jobs", "[.][benchmark]")
+{
+    const std::tuple jobs{Job{1'000}, Job{100'000}, Job{10'000}, Job{1'000'000}, Job{50'000}};
+    auto run = [](const Job& job) { return job(); };
+
+    BENCHMARK("sequential - std::apply")
+    {
+        return std::apply([&](const auto&... job) { return std::tuple{run(job)...}; }, jobs);
+    };
+
+    BENCHMARK("parallel_tuple_apply")
+    {
+        return vt::parallel_tuple_apply(run, jobs);
+    };
+}
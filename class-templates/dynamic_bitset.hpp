@@ -0,0 +1,414 @@
+#ifndef CLASS_TEMPLATES_DYNAMIC_BITSET_HPP
+#define CLASS_TEMPLATES_DYNAMIC_BITSET_HPP
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <span>
+#include <vector>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace details
+{
+    // Harley-Seal would be faster for huge sets, but Mula's nibble lookup is already
+    // memory-bound on AVX2 and keeps the code short
+    inline size_t popcount_bytes(const unsigned char* data, size_t size)
+    {
+        size_t total = 0;
+        size_t i = 0;
+
+#if defined(__AVX2__)
+        const __m256i lookup = _mm256_setr_epi8(
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+            0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+        const __m256i low_mask = _mm256_set1_epi8(0x0f);
+        __m256i acc = _mm256_setzero_si256();
+
+        for (; i + 32 <= size; i += 32)
+        {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+            const __m256i lo = _mm256_and_si256(v, low_mask);
+            const __m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+            const __m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo), _mm256_shuffle_epi8(lookup, hi));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(cnt, _mm256_setzero_si256()));
+        }
+
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        total = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#endif
+
+        // four independent accumulators - no dependency chain between popcnt instructions
+        uint64_t partial[4] = {};
+        for (; i + 32 <= size; i += 32)
+        {
+            for (size_t lane = 0; lane < 4; ++lane)
+            {
+                uint64_t word;
+                std::memcpy(&word, data + i + lane * 8, sizeof(word));
+                partial[lane] += std::popcount(word);
+            }
+        }
+        total += partial[0] + partial[1] + partial[2] + partial[3];
+
+        for (; i < size; ++i)
+            total += std::popcount(data[i]);
+
+        return total;
+    }
+} // namespace details
+
+/////////////////////////////////////////////////////////////////
+// DynamicBitset - word-level alternative for std::vector<bool>
+//
+// Bits beyond size() in the last word are always kept cleared, so count(),
+// comparison and the bulk operations can work on whole words.
+//
+template <std::unsigned_integral TWord = std::uint64_t>
+class DynamicBitset
+{
+public:
+    using word_type = TWord;
+    static constexpr size_t bits_per_word = std::numeric_limits<TWord>::digits;
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    class SetBitsIterator
+    {
+        const TWord* words_{};
+        size_t word_count_{};
+        size_t word_index_{};
+        TWord current_{};
+
+        void skip_empty_words()
+        {
+            while (current_ == 0 && ++word_index_ < word_count_)
+                current_ = words_[word_index_];
+        }
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = size_t;
+        using difference_type = std::ptrdiff_t;
+
+        SetBitsIterator() = default;
+
+        SetBitsIterator(const TWord* words, size_t word_count, size_t word_index)
+            : words_{words}
+            , word_count_{word_count}
+            , word_index_{word_index}
+            , current_{word_index < word_count ? words[word_index] : TWord{}}
+        {
+            if (word_index_ < word_count_)
+                skip_empty_words();
+        }
+
+        size_t operator*() const
+        {
+            return word_index_ * bits_per_word + std::countr_zero(current_);
+        }
+
+        SetBitsIterator& operator++()
+        {
+            current_ &= current_ - 1; // clears the lowest set bit
+            skip_empty_words();
+            return *this;
+        }
+
+        SetBitsIterator operator++(int)
+        {
+            auto tmp = *this;
+            ++(*this);
+            return tmp;
+        }
+
+        bool operator==(const SetBitsIterator& other) const
+        {
+            return word_index_ == other.word_index_ && current_ == other.current_;
+        }
+    };
+
+    struct SetBits
+    {
+        const TWord* words;
+        size_t word_count;
+
+        SetBitsIterator begin() const
+        {
+            return SetBitsIterator{words, word_count, 0};
+        }
+
+        SetBitsIterator end() const
+        {
+            return SetBitsIterator{words, word_count, word_count};
+        }
+    };
+
+    DynamicBitset() = default;
+
+    explicit DynamicBitset(size_t size, bool value = false)
+        : words_(word_count(size), value ? ~TWord{} : TWord{})
+        , size_{size}
+    {
+        clear_unused_bits();
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+
+    std::span<TWord> words()
+    {
+        return words_;
+    }
+
+    std::span<const TWord> words() const
+    {
+        return words_;
+    }
+
+    void resize(size_t size, bool value = false)
+    {
+        const size_t old_size = size_;
+        words_.resize(word_count(size), value ? ~TWord{} : TWord{});
+        size_ = size;
+
+        if (value && size > old_size && old_size % bits_per_word != 0)
+            words_[old_size / bits_per_word] |= ~TWord{} << (old_size % bits_per_word);
+
+        clear_unused_bits();
+    }
+
+    bool test(size_t pos) const
+    {
+        assert(pos < size_);
+        return (words_[pos / bits_per_word] >> (pos % bits_per_word)) & 1;
+    }
+
+    bool operator[](size_t pos) const
+    {
+        return test(pos);
+    }
+
+    DynamicBitset& set(size_t pos, bool value = true)
+    {
+        assert(pos < size_);
+        const TWord mask = TWord{1} << (pos % bits_per_word);
+        TWord& word = words_[pos / bits_per_word];
+        word = value ? (word | mask) : (word & ~mask);
+        return *this;
+    }
+
+    DynamicBitset& reset(size_t pos)
+    {
+        return set(pos, false);
+    }
+
+    DynamicBitset& flip(size_t pos)
+    {
+        assert(pos < size_);
+        words_[pos / bits_per_word] ^= TWord{1} << (pos % bits_per_word);
+        return *this;
+    }
+
+    DynamicBitset& set()
+    {
+        std::fill(words_.begin(), words_.end(), ~TWord{});
+        clear_unused_bits();
+        return *this;
+    }
+
+    DynamicBitset& reset()
+    {
+        std::fill(words_.begin(), words_.end(), TWord{});
+        return *this;
+    }
+
+    DynamicBitset& flip()
+    {
+        for (auto& word : words_)
+            word = ~word;
+        clear_unused_bits();
+        return *this;
+    }
+
+    size_t count() const
+    {
+        return details::popcount_bytes(reinterpret_cast<const unsigned char*>(words_.data()), words_.size() * sizeof(TWord));
+    }
+
+    bool any() const
+    {
+        return std::any_of(words_.begin(), words_.end(), [](TWord w) { return w != 0; });
+    }
+
+    bool none() const
+    {
+        return !any();
+    }
+
+    bool all() const
+    {
+        return count() == size_;
+    }
+
+    DynamicBitset& operator&=(const DynamicBitset& other)
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.size(); ++i)
+            words_[i] &= other.words_[i];
+        return *this;
+    }
+
+    DynamicBitset& operator|=(const DynamicBitset& other)
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.size(); ++i)
+            words_[i] |= other.words_[i];
+        return *this;
+    }
+
+    DynamicBitset& operator^=(const DynamicBitset& other)
+    {
+        assert(size_ == other.size_);
+        for (size_t i = 0; i < words_.size(); ++i)
+            words_[i] ^= other.words_[i];
+        return *this;
+    }
+
+    DynamicBitset operator~() const
+    {
+        DynamicBitset result{*this};
+        result.flip();
+        return result;
+    }
+
+    bool operator==(const DynamicBitset& other) const = default;
+
+    // number of bits set in a range [0, pos)
+    size_t rank(size_t pos) const
+    {
+        assert(pos <= size_);
+        const size_t full_words = pos / bits_per_word;
+        size_t result = details::popcount_bytes(reinterpret_cast<const unsigned char*>(words_.data()), full_words * sizeof(TWord));
+
+        if (const size_t tail = pos % bits_per_word; tail != 0)
+            result += std::popcount(static_cast<TWord>(words_[full_words] & ((TWord{1} << tail) - 1)));
+
+        return result;
+    }
+
+    // position of the n-th (counting from 0) set bit or npos
+    size_t select(size_t n) const
+    {
+        for (size_t i = 0; i < words_.size(); ++i)
+        {
+            const size_t bits = std::popcount(words_[i]);
+            if (n < bits)
+            {
+                TWord word = words_[i];
+                for (; n > 0; --n)
+                    word &= word - 1;
+                return i * bits_per_word + std::countr_zero(word);
+            }
+            n -= bits;
+        }
+
+        return npos;
+    }
+
+    size_t find_first() const
+    {
+        return find_from_word(0);
+    }
+
+    // position of the first set bit after pos or npos (also for pos == npos)
+    size_t find_next(size_t pos) const
+    {
+        if (pos >= size_ || ++pos == size_)
+            return npos;
+
+        const size_t index = pos / bits_per_word;
+        const TWord word = words_[index] & (~TWord{} << (pos % bits_per_word));
+
+        if (word != 0)
+            return index * bits_per_word + std::countr_zero(word);
+
+        return find_from_word(index + 1);
+    }
+
+    SetBits set_bits() const
+    {
+        return SetBits{words_.data(), words_.size()};
+    }
+
+    template <typename F>
+    void for_each_set(F&& f) const
+    {
+        for (size_t i = 0; i < words_.size(); ++i)
+        {
+            for (TWord word = words_[i]; word != 0; word &= word - 1)
+                f(i * bits_per_word + std::countr_zero(word));
+        }
+    }
+
+private:
+    std::vector<TWord> words_;
+    size_t size_{};
+
+    static size_t word_count(size_t size)
+    {
+        return (size + bits_per_word - 1) / bits_per_word;
+    }
+
+    void clear_unused_bits()
+    {
+        if (const size_t tail = size_ % bits_per_word; tail != 0)
+            words_.back() &= (TWord{1} << tail) - 1;
+    }
+
+    size_t find_from_word(size_t index) const
+    {
+        for (; index < words_.size(); ++index)
+        {
+            if (words_[index] != 0)
+                return index * bits_per_word + std::countr_zero(words_[index]);
+        }
+
+        return npos;
+    }
+};
+
+template <std::unsigned_integral TWord>
+DynamicBitset<TWord> operator&(DynamicBitset<TWord> lhs, const DynamicBitset<TWord>& rhs)
+{
+    return lhs &= rhs;
+}
+
+template <std::unsigned_integral TWord>
+DynamicBitset<TWord> operator|(DynamicBitset<TWord> lhs, const DynamicBitset<TWord>& rhs)
+{
+    return lhs |= rhs;
+}
+
+template <std::unsigned_integral TWord>
+DynamicBitset<TWord> operator^(DynamicBitset<TWord> lhs, const DynamicBitset<TWord>& rhs)
+{
+    return lhs ^= rhs;
+}
+
+#endif
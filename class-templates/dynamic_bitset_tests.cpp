@@ -0,0 +1,188 @@
+#include "dynamic_bitset.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <random>
+#include <vector>
+
+TEST_CASE("DynamicBitset - single bits")
+{
+    DynamicBitset<> bits(100);
+
+    REQUIRE(bits.size() == 100);
+    REQUIRE(bits.none());
+
+    bits.set(0).set(63).set(64).set(99);
+
+    CHECK(bits.test(0));
+    CHECK(bits[63]);
+    CHECK(bits[64]);
+    CHECK_FALSE(bits[65]);
+    CHECK(bits.count() == 4);
+
+    bits.reset(63).flip(1);
+
+    CHECK_FALSE(bits[63]);
+    CHECK(bits[1]);
+    CHECK(bits.count() == 4);
+}
+
+TEST_CASE("DynamicBitset - unused bits in last word stay cleared")
+{
+    DynamicBitset<> bits(70);
+
+    bits.flip();
+    CHECK(bits.count() == 70);
+    CHECK(bits.all());
+    CHECK((bits.words()[1] >> 6) == 0);
+
+    bits.resize(130, true);
+    CHECK(bits.count() == 130);
+
+    DynamicBitset<uint8_t> small(5, true);
+    CHECK(small.words()[0] == 0b11111);
+    CHECK((~small).none());
+}
+
+TEST_CASE("DynamicBitset - bulk operations")
+{
+    DynamicBitset<> a(200);
+    DynamicBitset<> b(200);
+
+    for (size_t i = 0; i < 200; i += 2)
+        a.set(i);
+    for (size_t i = 0; i < 200; i += 3)
+        b.set(i);
+
+    CHECK((a & b).count() == 34); // multiples of 6
+    CHECK((a | b).count() == 100 + 67 - 34);
+    CHECK((a ^ b).count() == 100 + 67 - 2 * 34);
+    CHECK((~a).count() == 100);
+    CHECK((a ^ a).none());
+}
+
+TEST_CASE("DynamicBitset - find, rank & select")
+{
+    DynamicBitset<> bits(1000);
+
+    CHECK(bits.find_first() == DynamicBitset<>::npos);
+
+    const std::vector<size_t> positions = {3, 64, 65, 500, 999};
+    for (auto pos : positions)
+        bits.set(pos);
+
+    SECTION("find_first & find_next")
+    {
+        std::vector<size_t> found;
+        for (size_t pos = bits.find_first(); pos != DynamicBitset<>::npos; pos = bits.find_next(pos))
+            found.push_back(pos);
+
+        CHECK(found == positions);
+
+        bits.set(0);
+        CHECK(bits.find_next(999) == DynamicBitset<>::npos);
+        CHECK(bits.find_next(1000) == DynamicBitset<>::npos);
+        CHECK(bits.find_next(DynamicBitset<>::npos) == DynamicBitset<>::npos);
+    }
+
+    SECTION("rank")
+    {
+        CHECK(bits.rank(0) == 0);
+        CHECK(bits.rank(4) == 1);
+        CHECK(bits.rank(65) == 2);
+        CHECK(bits.rank(1000) == 5);
+    }
+
+    SECTION("select")
+    {
+        for (size_t i = 0; i < positions.size(); ++i)
+            CHECK(bits.select(i) == positions[i]);
+
+        CHECK(bits.select(5) == DynamicBitset<>::npos);
+    }
+
+    SECTION("iteration over set bits")
+    {
+        std::vector<size_t> found(bits.set_bits().begin(), bits.set_bits().end());
+        CHECK(found == positions);
+
+        std::vector<size_t> visited;
+        bits.for_each_set([&visited](size_t pos) { visited.push_back(pos); });
+        CHECK(visited == positions);
+    }
+}
+
+TEST_CASE("DynamicBitset - count matches vector<bool>")
+{
+    std::mt19937_64 rnd{42};
+    const size_t size = 100'003;
+
+    DynamicBitset<> bits(size);
+    std::vector<bool> flags(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        const bool value = rnd() & 1;
+        bits.set(i, value);
+        flags[i] = value;
+    }
+
+    CHECK(bits.count() == static_cast<size_t>(std::count(flags.begin(), flags.end(), true)));
+}
+
+TEST_CASE("DynamicBitset vs. vector<bool>", "[.][benchmark]")
+{
+    const size_t size = 100'000'000;
+
+    std::mt19937_64 rnd{665};
+    DynamicBitset<> bits_a(size);
+    DynamicBitset<> bits_b(size);
+    for (auto& word : bits_a.words())
+        word = rnd();
+    for (auto& word : bits_b.words())
+        word = rnd();
+
+    std::vector<bool> flags_a(size);
+    std::vector<bool> flags_b(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        flags_a[i] = bits_a[i];
+        flags_b[i] = bits_b[i];
+    }
+
+    BENCHMARK("flip - vector<bool>")
+    {
+        flags_a.flip();
+        return flags_a.size();
+    };
+
+    BENCHMARK("flip - DynamicBitset")
+    {
+        bits_a.flip();
+        return bits_a.size();
+    };
+
+    BENCHMARK("count - vector<bool>")
+    {
+        return std::count(flags_a.begin(), flags_a.end(), true);
+    };
+
+    BENCHMARK("count - DynamicBitset")
+    {
+        return bits_a.count();
+    };
+
+    BENCHMARK("intersection - vector<bool>")
+    {
+        std::vector<bool> result(size);
+        for (size_t i = 0; i < size; ++i)
+            result[i] = flags_a[i] && flags_b[i];
+        return result.size();
+    };
+
+    BENCHMARK("intersection - DynamicBitset")
+    {
+        return (bits_a & bits_b).size();
+    };
+}
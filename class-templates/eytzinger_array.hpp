@@ -0,0 +1,211 @@
+#ifndef CLASS_TEMPLATES_EYTZINGER_ARRAY_HPP
+#define CLASS_TEMPLATES_EYTZINGER_ARRAY_HPP
+
+#include "array.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace details
+{
+    template <typename T>
+    void prefetch(const T* ptr)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        __builtin_prefetch(ptr);
+#else
+        (void)ptr;
+#endif
+    }
+} // namespace details
+
+/////////////////////////////////////////////////////////////////
+// EytzingerArray - sorted Array stored in BFS order of an implicit binary tree
+//
+// Node k has children 2k and 2k+1, so the first levels of the tree share a few
+// cache lines and the grandchildren a few levels down can be prefetched before
+// they are needed. Searching returns indexes of the original sorted Array.
+//
+template <typename T, size_t N>
+class EytzingerArray
+{
+    static_assert(N > 0);
+
+    // nodes visited in the next 4 iterations (16 descendants) - a cache line for 4-byte keys
+    static constexpr size_t prefetch_block = 16;
+
+public:
+    constexpr explicit EytzingerArray(const Array<T, N>& sorted)
+    {
+        size_t next = 0;
+        build(sorted, next, 1);
+    }
+
+    constexpr size_t size() const
+    {
+        return N;
+    }
+
+    // index of the first element not less than value (N if there is none)
+    constexpr size_t lower_bound(const T& value) const
+    {
+        size_t k = 1;
+
+        while (k <= N)
+        {
+            if (!std::is_constant_evaluated())
+                details::prefetch(nodes_.items + std::min(k * prefetch_block, N));
+            k = 2 * k + (nodes_.items[k] < value); // branchless - compiled to setb/adc
+        }
+
+        // the answer is the last node where search went left - undo the right turns
+        // and the final left turn
+        k >>= std::countr_one(k) + 1;
+
+        return k == 0 ? N : sorted_index_.items[k];
+    }
+
+    constexpr bool contains(const T& value) const
+    {
+        const size_t index = lower_bound(value);
+        return index != N && at_sorted(index) == value;
+    }
+
+    // element of the sorted sequence - kept to avoid storing a copy of the source Array
+    constexpr const T& at_sorted(size_t index) const
+    {
+        return nodes_.items[eytzinger_index_.items[index]];
+    }
+
+private:
+    alignas(64) Array<T, N + 1> nodes_{}; // nodes_[0] is unused - the root is nodes_[1]
+    Array<uint32_t, N + 1> sorted_index_{};
+    Array<uint32_t, N> eytzinger_index_{};
+
+    constexpr void build(const Array<T, N>& sorted, size_t& next, size_t k)
+    {
+        if (k > N)
+            return;
+
+        build(sorted, next, 2 * k);
+        nodes_.items[k] = sorted.items[next];
+        sorted_index_.items[k] = static_cast<uint32_t>(next);
+        eytzinger_index_.items[next] = static_cast<uint32_t>(k);
+        ++next;
+        build(sorted, next, 2 * k + 1);
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// STreeArray - sorted Array stored as an implicit static B-tree (S-tree)
+//
+// Each node holds B keys in one 64-byte cache line. Position inside the node
+// is found by comparing all keys at once and counting the matches (SIMD for
+// int32_t + AVX2, auto-vectorized loop otherwise), so there is one cache miss
+// per level instead of one per comparison.
+//
+template <typename T, size_t N>
+class STreeArray
+{
+    static_assert(N > 0);
+    static_assert(std::is_arithmetic_v<T>);
+
+public:
+    static constexpr size_t keys_per_node = 64 / sizeof(T);
+    static constexpr size_t node_count = (N + keys_per_node - 1) / keys_per_node;
+
+    constexpr explicit STreeArray(const Array<T, N>& sorted)
+    {
+        size_t next = 0;
+        build(sorted, next, 0);
+    }
+
+    constexpr size_t size() const
+    {
+        return N;
+    }
+
+    // index of the first element not less than value (N if there is none)
+    size_t lower_bound(const T& value) const
+    {
+        size_t result = N;
+        size_t k = 0;
+
+        while (k < node_count)
+        {
+            const size_t i = count_less(nodes_.items[k], value);
+            if (i < keys_per_node)
+                result = indexes_.items[k].keys[i];
+            k = child(k, i);
+        }
+
+        return result;
+    }
+
+private:
+    struct alignas(64) Node
+    {
+        T keys[keys_per_node];
+    };
+
+    struct Indexes
+    {
+        uint32_t keys[keys_per_node];
+    };
+
+    Array<Node, node_count> nodes_{};
+    Array<Indexes, node_count> indexes_{};
+
+    static constexpr size_t child(size_t k, size_t i)
+    {
+        return k * (keys_per_node + 1) + i + 1;
+    }
+
+    static size_t count_less(const Node& node, const T& value)
+    {
+#if defined(__AVX2__)
+        if constexpr (std::is_same_v<T, int32_t>)
+        {
+            const __m256i x = _mm256_set1_epi32(value);
+            const __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys));
+            const __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(node.keys + 8));
+            const unsigned mask_a = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, a)));
+            const unsigned mask_b = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, b)));
+            return std::popcount(mask_a | (mask_b << 8));
+        }
+#endif
+        size_t count = 0;
+        for (size_t i = 0; i < keys_per_node; ++i)
+            count += node.keys[i] < value;
+        return count;
+    }
+
+    // in-order traversal - keys of the subtree at child(k, i) precede keys[i] of node k;
+    // missing keys are padded with max() and index N
+    constexpr void build(const Array<T, N>& sorted, size_t& next, size_t k)
+    {
+        if (k >= node_count)
+            return;
+
+        for (size_t i = 0; i < keys_per_node; ++i)
+        {
+            build(sorted, next, child(k, i));
+
+            const bool has_key = next < N;
+            nodes_.items[k].keys[i] = has_key ? sorted.items[next] : std::numeric_limits<T>::max();
+            indexes_.items[k].keys[i] = static_cast<uint32_t>(has_key ? next++ : N);
+        }
+
+        build(sorted, next, child(k, keys_per_node));
+    }
+};
+
+#endif
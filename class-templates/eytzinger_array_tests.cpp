@@ -0,0 +1,118 @@
+#include "eytzinger_array.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    constexpr Array<int, 10> sorted_data = {1, 3, 3, 5, 8, 13, 21, 34, 55, 89};
+    constexpr EytzingerArray<int, 10> eytzinger_data{sorted_data};
+
+    static_assert(eytzinger_data.lower_bound(0) == 0);
+    static_assert(eytzinger_data.lower_bound(3) == 1);
+    static_assert(eytzinger_data.lower_bound(4) == 3);
+    static_assert(eytzinger_data.lower_bound(89) == 9);
+    static_assert(eytzinger_data.lower_bound(90) == 10);
+    static_assert(eytzinger_data.contains(21));
+    static_assert(!eytzinger_data.contains(22));
+    static_assert(eytzinger_data.at_sorted(4) == 8);
+
+    template <typename TSearch, size_t N>
+    void check_against_std_lower_bound(const Array<int, N>& sorted, const TSearch& search)
+    {
+        for (int value = sorted[0] - 2; value <= sorted[N - 1] + 2; ++value)
+        {
+            const auto expected = static_cast<size_t>(std::lower_bound(sorted.begin(), sorted.end(), value) - sorted.begin());
+            REQUIRE(search.lower_bound(value) == expected);
+        }
+    }
+
+    template <size_t N>
+    std::unique_ptr<Array<int, N>> make_sorted_array(unsigned seed)
+    {
+        auto data = std::make_unique<Array<int, N>>();
+        std::mt19937 rnd{seed};
+        std::uniform_int_distribution<int> distr(0, static_cast<int>(4 * N));
+
+        std::generate(data->begin(), data->end(), [&] { return distr(rnd); });
+        std::sort(data->begin(), data->end());
+
+        return data;
+    }
+} // namespace
+
+TEST_CASE("EytzingerArray - same results as std::lower_bound")
+{
+    check_against_std_lower_bound(sorted_data, eytzinger_data);
+
+    auto data = make_sorted_array<1000>(42);
+    check_against_std_lower_bound(*data, EytzingerArray<int, 1000>{*data});
+}
+
+TEST_CASE("STreeArray - same results as std::lower_bound")
+{
+    check_against_std_lower_bound(sorted_data, STreeArray<int, 10>{sorted_data});
+
+    auto data = make_sorted_array<1000>(42);
+    check_against_std_lower_bound(*data, *std::make_unique<STreeArray<int, 1000>>(*data));
+
+    Array<double, 5> doubles = {0.5, 1.5, 2.5, 3.5, 4.5};
+    STreeArray<double, 5> stree_doubles{doubles};
+    CHECK(stree_doubles.lower_bound(2.0) == 2);
+    CHECK(stree_doubles.lower_bound(5.0) == 5);
+}
+
+namespace
+{
+    template <size_t N>
+    void benchmark_lower_bound()
+    {
+        auto sorted = make_sorted_array<N>(665);
+        auto eytzinger = std::make_unique<EytzingerArray<int, N>>(*sorted);
+        auto stree = std::make_unique<STreeArray<int, N>>(*sorted);
+
+        std::mt19937 rnd{42};
+        std::uniform_int_distribution<int> distr(0, static_cast<int>(4 * N));
+        std::vector<int> queries(10'000);
+        std::generate(queries.begin(), queries.end(), [&] { return distr(rnd); });
+
+        const auto size = std::to_string(N);
+
+        BENCHMARK("std::lower_bound - N=" + size)
+        {
+            size_t sum = 0;
+            for (int value : queries)
+                sum += std::lower_bound(sorted->begin(), sorted->end(), value) - sorted->begin();
+            return sum;
+        };
+
+        BENCHMARK("EytzingerArray - N=" + size)
+        {
+            size_t sum = 0;
+            for (int value : queries)
+                sum += eytzinger->lower_bound(value);
+            return sum;
+        };
+
+        BENCHMARK("STreeArray - N=" + size)
+        {
+            size_t sum = 0;
+            for (int value : queries)
+                sum += stree->lower_bound(value);
+            return sum;
+        };
+    }
+} // namespace
+
+TEST_CASE("EytzingerArray & STreeArray vs. std::lower_bound", "[.][benchmark]")
+{
+    benchmark_lower_bound<64>();
+    benchmark_lower_bound<4'096>();
+    benchmark_lower_bound<262'144>();
+    benchmark_lower_bound<10'000'000>();
+}
@@ -0,0 +1,200 @@
+#ifndef CLASS_TEMPLATES_FLAT_DICTIONARY_HPP
+#define CLASS_TEMPLATES_FLAT_DICTIONARY_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// FlatDictionary - read-only, sorted & contiguous replacement for Dictionary<T>
+//
+// Keys are packed into a single character buffer, values are kept in a separate
+// vector in key order. Each key has also an 8-byte big-endian prefix, so most
+// probes of the binary search compare two integers and never touch the characters.
+//
+template <typename T>
+class FlatDictionary
+{
+public:
+    using key_type = std::string_view;
+    using mapped_type = T;
+
+    class Builder
+    {
+        std::vector<std::pair<std::string, T>> items_;
+
+    public:
+        Builder() = default;
+
+        explicit Builder(size_t expected_size)
+        {
+            items_.reserve(expected_size);
+        }
+
+        Builder& add(std::string_view key, T value)
+        {
+            items_.emplace_back(std::string(key), std::move(value));
+            return *this;
+        }
+
+        // as for std::map::insert - the first value inserted for a key wins
+        FlatDictionary freeze() &&
+        {
+            std::stable_sort(items_.begin(), items_.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+            auto last = std::unique(items_.begin(), items_.end(), [](const auto& a, const auto& b) { return a.first == b.first; });
+            items_.erase(last, items_.end());
+
+            return FlatDictionary{std::move(items_)};
+        }
+    };
+
+    FlatDictionary() = default;
+
+    FlatDictionary(std::initializer_list<std::pair<std::string_view, T>> items)
+    {
+        Builder builder{items.size()};
+        for (const auto& [key, value] : items)
+            builder.add(key, value);
+        *this = std::move(builder).freeze();
+    }
+
+    size_t size() const
+    {
+        return values_.size();
+    }
+
+    bool empty() const
+    {
+        return values_.empty();
+    }
+
+    std::string_view key(size_t index) const
+    {
+        return std::string_view{chars_.data() + offsets_[index], offsets_[index + 1] - offsets_[index]};
+    }
+
+    std::span<const T> values() const
+    {
+        return values_;
+    }
+
+    std::span<T> values()
+    {
+        return values_;
+    }
+
+    const T* find(std::string_view key) const
+    {
+        const size_t index = lower_bound(key);
+        return (index < size() && this->key(index) == key) ? &values_[index] : nullptr;
+    }
+
+    T* find(std::string_view key)
+    {
+        return const_cast<T*>(std::as_const(*this).find(key));
+    }
+
+    bool contains(std::string_view key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    const T& at(std::string_view key) const
+    {
+        if (const T* value = find(key))
+            return *value;
+
+        throw std::out_of_range("key not found");
+    }
+
+    T& at(std::string_view key)
+    {
+        return const_cast<T&>(std::as_const(*this).at(key));
+    }
+
+    // bytes owned by the dictionary (without sizeof(*this))
+    size_t memory_usage() const
+    {
+        return chars_.capacity() + offsets_.capacity() * sizeof(uint32_t)
+            + prefixes_.capacity() * sizeof(uint64_t) + values_.capacity() * sizeof(T);
+    }
+
+private:
+    std::string chars_;
+    std::vector<uint32_t> offsets_{0};
+    std::vector<uint64_t> prefixes_;
+    std::vector<T> values_;
+
+    explicit FlatDictionary(std::vector<std::pair<std::string, T>>&& sorted_items)
+    {
+        const size_t total_length = std::accumulate(sorted_items.begin(), sorted_items.end(), size_t{},
+            [](size_t total, const auto& item) { return total + item.first.size(); });
+
+        if (total_length > std::numeric_limits<uint32_t>::max())
+            throw std::length_error("FlatDictionary keys exceed 4 GB");
+
+        chars_.reserve(total_length);
+        offsets_.reserve(sorted_items.size() + 1);
+        prefixes_.reserve(sorted_items.size());
+        values_.reserve(sorted_items.size());
+
+        for (auto& [key, value] : sorted_items)
+        {
+            chars_ += key;
+            offsets_.push_back(static_cast<uint32_t>(chars_.size()));
+            prefixes_.push_back(prefix_of(key));
+            values_.push_back(std::move(value));
+        }
+    }
+
+    // big-endian prefix - integer order is the same as lexicographic order of the first 8 chars
+    static uint64_t prefix_of(std::string_view key)
+    {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < sizeof(uint64_t); ++i)
+        {
+            prefix <<= 8;
+            if (i < key.size())
+                prefix |= static_cast<unsigned char>(key[i]);
+        }
+        return prefix;
+    }
+
+    bool is_less(size_t index, uint64_t prefix, std::string_view key) const
+    {
+        const uint64_t probe = prefixes_[index];
+        return probe < prefix || (probe == prefix && this->key(index) < key);
+    }
+
+    // branchless lower bound - the loop has a fixed trip count for a given size
+    // and the comparison result selects the next base with cmov
+    size_t lower_bound(std::string_view key) const
+    {
+        size_t n = size();
+        if (n == 0)
+            return 0;
+
+        const uint64_t prefix = prefix_of(key);
+        size_t base = 0;
+
+        while (n > 1)
+        {
+            const size_t half = n / 2;
+            base = is_less(base + half - 1, prefix, key) ? base + half : base;
+            n -= half;
+        }
+
+        return base + is_less(base, prefix, key);
+    }
+};
+
+#endif
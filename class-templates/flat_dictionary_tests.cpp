@@ -0,0 +1,143 @@
+#include "flat_dictionary.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+
+using namespace std::literals;
+
+TEST_CASE("FlatDictionary - lookup")
+{
+    FlatDictionary<int> dict = {{"one", 1}, {"two", 2}, {"three", 3}};
+
+    REQUIRE(dict.size() == 3);
+
+    SECTION("keys are sorted")
+    {
+        CHECK(dict.key(0) == "one");
+        CHECK(dict.key(1) == "three");
+        CHECK(dict.key(2) == "two");
+    }
+
+    SECTION("heterogeneous lookup - no temporary std::string")
+    {
+        CHECK(dict.at("two") == 2);
+        CHECK(dict.at("three"sv) == 3);
+        CHECK(dict.at("one"s) == 1);
+        CHECK(dict.find("four") == nullptr);
+        CHECK_FALSE(dict.contains("on"));
+        CHECK_FALSE(dict.contains("onex"));
+    }
+
+    SECTION("values are mutable")
+    {
+        *dict.find("one") = 11;
+        CHECK(dict.at("one") == 11);
+    }
+
+    SECTION("missing key throws")
+    {
+        REQUIRE_THROWS_AS(dict.at("zero"), std::out_of_range);
+    }
+}
+
+TEST_CASE("FlatDictionary - builder")
+{
+    FlatDictionary<int>::Builder builder;
+    builder.add("same-prefix-b", 2).add("same-prefix-a", 1).add("same-prefix-b", 3).add("", 0).add("same", 4);
+
+    auto dict = std::move(builder).freeze();
+
+    REQUIRE(dict.size() == 4);
+    CHECK(dict.at("") == 0);
+    CHECK(dict.at("same") == 4);
+    CHECK(dict.at("same-prefix-a") == 1);
+    CHECK(dict.at("same-prefix-b") == 2); // first inserted value wins - as in std::map
+    CHECK_FALSE(dict.contains("same-prefix-c"));
+}
+
+TEST_CASE("FlatDictionary - same results as std::map")
+{
+    std::mt19937_64 rnd{42};
+    std::map<std::string, int> reference;
+    FlatDictionary<int>::Builder builder;
+
+    for (int i = 0; i < 5'000; ++i)
+    {
+        auto key = std::to_string(rnd() % 10'000);
+        reference.emplace(key, i);
+        builder.add(key, i);
+    }
+
+    auto dict = std::move(builder).freeze();
+    REQUIRE(dict.size() == reference.size());
+
+    for (int i = 0; i < 10'000; ++i)
+    {
+        const auto key = std::to_string(i);
+        const auto it = reference.find(key);
+        const int* value = dict.find(key);
+
+        REQUIRE((it == reference.end()) == (value == nullptr));
+        if (value)
+            REQUIRE(*value == it->second);
+    }
+}
+
+namespace
+{
+    size_t estimated_memory_usage(const std::map<std::string, int>& dict)
+    {
+        constexpr size_t rb_node_header = 4 * sizeof(void*); // color + parent + left + right
+        size_t total = dict.size() * (rb_node_header + sizeof(std::pair<const std::string, int>));
+
+        for (const auto& [key, value] : dict)
+            if (key.capacity() > std::string{}.capacity())
+                total += key.capacity() + 1;
+
+        return total;
+    }
+} // namespace
+
+TEST_CASE("FlatDictionary vs. Dictionary", "[.][benchmark]")
+{
+    const size_t size = GENERATE(1'000, 100'000, 10'000'000);
+
+    std::map<std::string, int> dict;
+    FlatDictionary<int>::Builder builder{size};
+    for (size_t i = 0; i < size; ++i)
+    {
+        auto key = "key-" + std::to_string(i * 7919);
+        dict.emplace(key, static_cast<int>(i));
+        builder.add(key, static_cast<int>(i));
+    }
+    auto flat_dict = std::move(builder).freeze();
+
+    std::mt19937_64 rnd{665};
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < 1'000; ++i)
+        queries.push_back("key-" + std::to_string((rnd() % size) * 7919));
+
+    std::cout << "size: " << size << "; memory - Dictionary: " << estimated_memory_usage(dict)
+              << " B, FlatDictionary: " << flat_dict.memory_usage() << " B\n";
+
+    BENCHMARK("Dictionary - 1000 lookups - size " + std::to_string(size))
+    {
+        long sum = 0;
+        for (const auto& key : queries)
+            sum += dict.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("FlatDictionary - 1000 lookups - size " + std::to_string(size))
+    {
+        long sum = 0;
+        for (const auto& key : queries)
+            sum += *flat_dict.find(key);
+        return sum;
+    };
+}
@@ -0,0 +1,190 @@
+#ifndef CLASS_TEMPLATES_PERFECT_HASH_DICTIONARY_HPP
+#define CLASS_TEMPLATES_PERFECT_HASH_DICTIONARY_HPP
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace details
+{
+    constexpr uint64_t fnv1a_hash(std::string_view key)
+    {
+        uint64_t hash = 0xcbf29ce484222325ULL;
+        for (char c : key)
+        {
+            hash ^= static_cast<unsigned char>(c);
+            hash *= 0x100000001b3ULL;
+        }
+        return hash;
+    }
+
+    // splitmix64 finalizer - a different seed gives an independent hash of the same key
+    constexpr uint64_t mix_hash(uint64_t hash, uint64_t seed)
+    {
+        hash += seed * 0x9e3779b97f4a7c15ULL;
+        hash = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        hash = (hash ^ (hash >> 27)) * 0x94d049bb133111ebULL;
+        return hash ^ (hash >> 31);
+    }
+} // namespace details
+
+/////////////////////////////////////////////////////////////////
+// PerfectHashDictionary - read-only dictionary for keys known at compile time
+//
+// Two-level (hash & displace) perfect hashing: the first hash selects a bucket,
+// the bucket stores either a seed of the second hash or - for single-key buckets -
+// the slot itself. Lookup is always: hash, two table reads, one key comparison.
+//
+template <typename T, size_t N>
+class PerfectHashDictionary
+{
+    static_assert(N > 0, "PerfectHashDictionary requires at least one key");
+
+public:
+    static constexpr size_t table_size = std::bit_ceil(N);
+    static constexpr size_t bucket_count = std::max<size_t>(1, table_size / 2);
+
+    using Item = std::pair<std::string_view, T>;
+
+    constexpr explicit PerfectHashDictionary(const std::array<Item, N>& items)
+    {
+        std::array<uint32_t, N> bucket_of{};
+        std::array<uint32_t, bucket_count> bucket_sizes{};
+
+        for (size_t i = 0; i < N; ++i)
+        {
+            for (size_t j = 0; j < i; ++j)
+                if (items[i].first == items[j].first)
+                    throw std::invalid_argument("duplicated key");
+
+            bucket_of[i] = static_cast<uint32_t>(details::fnv1a_hash(items[i].first) & (bucket_count - 1));
+            ++bucket_sizes[bucket_of[i]];
+        }
+
+        // the biggest buckets are placed first - while the table is still empty
+        std::array<uint32_t, bucket_count> buckets{};
+        for (size_t b = 0; b < bucket_count; ++b)
+            buckets[b] = static_cast<uint32_t>(b);
+        std::sort(buckets.begin(), buckets.end(), [&](uint32_t a, uint32_t b) {
+            return bucket_sizes[a] != bucket_sizes[b] ? bucket_sizes[a] > bucket_sizes[b] : a < b;
+        });
+
+        std::array<bool, table_size> occupied{};
+        std::array<size_t, N> members{};
+
+        for (uint32_t bucket : buckets)
+        {
+            size_t member_count = 0;
+            for (size_t i = 0; i < N; ++i)
+                if (bucket_of[i] == bucket)
+                    members[member_count++] = i;
+
+            if (member_count == 0)
+                continue;
+
+            if (member_count == 1)
+            {
+                const size_t slot = static_cast<size_t>(std::find(occupied.begin(), occupied.end(), false) - occupied.begin());
+                displacements_[bucket] = -static_cast<int32_t>(slot) - 1;
+                place(items[members[0]], slot, occupied);
+                continue;
+            }
+
+            displacements_[bucket] = find_displacement(items, members, member_count, occupied);
+            for (size_t m = 0; m < member_count; ++m)
+                place(items[members[m]], slot_of(items[members[m]].first, displacements_[bucket]), occupied);
+        }
+
+        // empty slots repeat the first key - a lookup can never reach them with that key,
+        // so no separate "occupied" check is needed at runtime
+        for (size_t slot = 0; slot < table_size; ++slot)
+            if (!occupied[slot])
+                keys_[slot] = items[0].first;
+    }
+
+    constexpr size_t size() const
+    {
+        return N;
+    }
+
+    constexpr const T* find(std::string_view key) const
+    {
+        const uint64_t hash = details::fnv1a_hash(key);
+        const int32_t displacement = displacements_[hash & (bucket_count - 1)];
+        const size_t slot = displacement < 0
+            ? static_cast<size_t>(-displacement - 1)
+            : details::mix_hash(hash, static_cast<uint64_t>(displacement)) & (table_size - 1);
+
+        return keys_[slot] == key ? &values_[slot] : nullptr;
+    }
+
+    constexpr bool contains(std::string_view key) const
+    {
+        return find(key) != nullptr;
+    }
+
+    constexpr const T& at(std::string_view key) const
+    {
+        if (const T* value = find(key))
+            return *value;
+
+        throw std::out_of_range("key not found");
+    }
+
+private:
+    std::array<int32_t, bucket_count> displacements_{};
+    std::array<std::string_view, table_size> keys_{};
+    std::array<T, table_size> values_{};
+
+    static constexpr size_t slot_of(std::string_view key, int32_t displacement)
+    {
+        return details::mix_hash(details::fnv1a_hash(key), static_cast<uint64_t>(displacement)) & (table_size - 1);
+    }
+
+    constexpr void place(const Item& item, size_t slot, std::array<bool, table_size>& occupied)
+    {
+        keys_[slot] = item.first;
+        values_[slot] = item.second;
+        occupied[slot] = true;
+    }
+
+    static constexpr int32_t find_displacement(const std::array<Item, N>& items, const std::array<size_t, N>& members,
+        size_t member_count, const std::array<bool, table_size>& occupied)
+    {
+        constexpr int32_t max_displacement = 1 << 20;
+
+        for (int32_t displacement = 0; displacement < max_displacement; ++displacement)
+        {
+            std::array<bool, table_size> taken = occupied;
+            bool collision = false;
+
+            for (size_t m = 0; m < member_count && !collision; ++m)
+            {
+                const size_t slot = slot_of(items[members[m]].first, displacement);
+                collision = taken[slot];
+                taken[slot] = true;
+            }
+
+            if (!collision)
+                return displacement;
+        }
+
+        throw std::logic_error("perfect hash displacement not found");
+    }
+};
+
+template <typename T, size_t N>
+consteval PerfectHashDictionary<T, N> make_perfect_hash_dictionary(const std::pair<std::string_view, T> (&items)[N])
+{
+    std::array<std::pair<std::string_view, T>, N> list{};
+    std::copy(items, items + N, list.begin());
+
+    return PerfectHashDictionary<T, N>{list};
+}
+
+#endif
@@ -0,0 +1,99 @@
+#include "perfect_hash_dictionary.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace std::literals;
+
+namespace
+{
+    constexpr auto numbers = make_perfect_hash_dictionary<int>({{"one", 1}, {"two", 2}, {"three", 3}});
+
+    static_assert(numbers.size() == 3);
+    static_assert(numbers.at("one") == 1);
+    static_assert(numbers.at("two") == 2);
+    static_assert(numbers.at("three") == 3);
+    static_assert(!numbers.contains("four"));
+    static_assert(!numbers.contains(""));
+    static_assert(sizeof(numbers) < 128);
+
+    constexpr std::pair<std::string_view, int> keywords[] = {
+        {"alignas", 0}, {"alignof", 1}, {"auto", 2}, {"bool", 3}, {"break", 4}, {"case", 5}, {"catch", 6},
+        {"char", 7}, {"class", 8}, {"concept", 9}, {"const", 10}, {"consteval", 11}, {"constexpr", 12},
+        {"constinit", 13}, {"continue", 14}, {"co_await", 15}, {"co_return", 16}, {"co_yield", 17},
+        {"decltype", 18}, {"default", 19}, {"delete", 20}, {"do", 21}, {"double", 22}, {"else", 23},
+        {"enum", 24}, {"explicit", 25}, {"export", 26}, {"extern", 27}, {"false", 28}, {"float", 29},
+        {"for", 30}, {"friend", 31}, {"goto", 32}, {"if", 33}, {"inline", 34}, {"int", 35}, {"long", 36},
+        {"mutable", 37}, {"namespace", 38}, {"new", 39}, {"noexcept", 40}, {"nullptr", 41}, {"operator", 42},
+        {"private", 43}, {"protected", 44}, {"public", 45}, {"requires", 46}, {"return", 47}, {"short", 48},
+        {"signed", 49}, {"sizeof", 50}, {"static", 51}, {"struct", 52}, {"switch", 53}, {"template", 54},
+        {"this", 55}, {"throw", 56}, {"true", 57}, {"try", 58}, {"typedef", 59}, {"typename", 60},
+        {"union", 61}, {"unsigned", 62}, {"using", 63}, {"virtual", 64}, {"void", 65}, {"volatile", 66},
+        {"while", 67}};
+
+    constexpr auto keyword_ids = make_perfect_hash_dictionary(keywords);
+
+    constexpr bool all_keywords_found()
+    {
+        for (const auto& [key, value] : keywords)
+            if (keyword_ids.at(key) != value)
+                return false;
+        return true;
+    }
+
+    static_assert(keyword_ids.size() == std::size(keywords));
+    static_assert(all_keywords_found());
+    static_assert(!keyword_ids.contains("foreach"));
+} // namespace
+
+TEST_CASE("PerfectHashDictionary - runtime lookup")
+{
+    const std::string key = "t"s + "wo";
+
+    CHECK(numbers.at(key) == 2);
+    CHECK(numbers.find("zero") == nullptr);
+    REQUIRE_THROWS_AS(numbers.at("zero"), std::out_of_range);
+
+    for (const auto& [keyword, id] : keywords)
+        CHECK(*keyword_ids.find(std::string(keyword)) == id);
+}
+
+TEST_CASE("PerfectHashDictionary vs. std::map & std::unordered_map", "[.][benchmark]")
+{
+    const std::map<std::string, int, std::less<>> map(std::begin(keywords), std::end(keywords));
+    const std::unordered_map<std::string_view, int> hash_map(std::begin(keywords), std::end(keywords));
+
+    std::mt19937_64 rnd{665};
+    std::vector<std::string> queries;
+    for (size_t i = 0; i < 1'000; ++i)
+        queries.emplace_back(keywords[rnd() % std::size(keywords)].first);
+
+    BENCHMARK("std::map - 1000 lookups")
+    {
+        int sum = 0;
+        for (const auto& key : queries)
+            sum += map.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("std::unordered_map - 1000 lookups")
+    {
+        int sum = 0;
+        for (const auto& key : queries)
+            sum += hash_map.find(key)->second;
+        return sum;
+    };
+
+    BENCHMARK("PerfectHashDictionary - 1000 lookups")
+    {
+        int sum = 0;
+        for (const auto& key : queries)
+            sum += *keyword_ids.find(key);
+        return sum;
+    };
+}
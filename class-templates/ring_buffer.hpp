@@ -0,0 +1,163 @@
+#ifndef CLASS_TEMPLATES_RING_BUFFER_HPP
+#define CLASS_TEMPLATES_RING_BUFFER_HPP
+
+#include "accumulate.hpp"
+#include "array.hpp"
+
+#include <bit>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////
+// RingBuffer - fixed-capacity FIFO over Array<T, N> with a sliding window statistics
+//
+// Pushing into a full buffer evicts the oldest item, so the buffer is always
+// a window of the last N samples. Sum is kept in Traits::AccumulatorType and
+// updated with every push/pop (for floating point it may drift by rounding
+// errors of the subtractions); min & max are kept in monotonic queues of
+// sequence numbers - each item enters and leaves a queue once, so every
+// operation is O(1) amortized.
+//
+template <typename T, size_t N, typename Traits = AccumulationTraits<T>>
+class RingBuffer
+{
+    static_assert(std::has_single_bit(N), "capacity of RingBuffer must be a power of two");
+
+    static constexpr uint64_t mask = N - 1;
+
+    // monotonic queue of sequence numbers of items that can still become min (or max)
+    class MonotonicQueue
+    {
+        Array<uint64_t, N> seqs_{};
+        uint64_t head_{};
+        uint64_t tail_{};
+
+    public:
+        uint64_t front() const
+        {
+            return seqs_[head_ & mask];
+        }
+
+        bool empty() const
+        {
+            return head_ == tail_;
+        }
+
+        template <typename TDominates>
+        void push(uint64_t seq, const Array<T, N>& items, TDominates dominates)
+        {
+            const T& value = items[seq & mask];
+            while (!empty() && dominates(value, items[seqs_[(tail_ - 1) & mask] & mask]))
+                --tail_;
+            seqs_[tail_++ & mask] = seq;
+        }
+
+        void evict(uint64_t seq)
+        {
+            if (!empty() && front() == seq)
+                ++head_;
+        }
+    };
+
+public:
+    using value_type = T;
+    using AccumulatorType = typename Traits::AccumulatorType;
+
+    constexpr size_t capacity() const
+    {
+        return N;
+    }
+
+    size_t size() const
+    {
+        return static_cast<size_t>(tail_ - head_);
+    }
+
+    bool empty() const
+    {
+        return head_ == tail_;
+    }
+
+    bool full() const
+    {
+        return size() == N;
+    }
+
+    // oldest item has index 0
+    const T& operator[](size_t index) const
+    {
+        assert(index < size());
+        return items_[(head_ + index) & mask];
+    }
+
+    const T& front() const
+    {
+        return (*this)[0];
+    }
+
+    const T& back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    void push(const T& value)
+    {
+        if (full())
+            pop();
+
+        const uint64_t seq = tail_++;
+        items_[seq & mask] = value;
+
+        SumPolicy::accumulate(sum_, value);
+        min_queue_.push(seq, items_, [](const T& a, const T& b) { return a <= b; });
+        max_queue_.push(seq, items_, [](const T& a, const T& b) { return b <= a; });
+    }
+
+    T pop()
+    {
+        assert(!empty());
+
+        const uint64_t seq = head_++;
+        T value = items_[seq & mask];
+
+        sum_ -= value;
+        min_queue_.evict(seq);
+        max_queue_.evict(seq);
+
+        return value;
+    }
+
+    AccumulatorType sum() const
+    {
+        return sum_;
+    }
+
+    const T& min() const
+    {
+        assert(!empty());
+        return items_[min_queue_.front() & mask];
+    }
+
+    const T& max() const
+    {
+        assert(!empty());
+        return items_[max_queue_.front() & mask];
+    }
+
+    double mean() const
+    {
+        assert(!empty());
+        return static_cast<double>(sum_) / static_cast<double>(size());
+    }
+
+private:
+    Array<T, N> items_{};
+    uint64_t head_{};
+    uint64_t tail_{};
+    AccumulatorType sum_ = Traits::zero;
+    MonotonicQueue min_queue_;
+    MonotonicQueue max_queue_;
+};
+
+#endif
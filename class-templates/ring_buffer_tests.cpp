@@ -0,0 +1,148 @@
+#include "ring_buffer.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <deque>
+#include <memory>
+#include <numeric>
+#include <random>
+#include <vector>
+
+TEST_CASE("RingBuffer - FIFO")
+{
+    RingBuffer<int, 4> buffer;
+
+    REQUIRE(buffer.empty());
+    REQUIRE(buffer.capacity() == 4);
+
+    buffer.push(1);
+    buffer.push(2);
+    buffer.push(3);
+
+    CHECK(buffer.size() == 3);
+    CHECK(buffer.front() == 1);
+    CHECK(buffer.back() == 3);
+
+    SECTION("pop returns the oldest item")
+    {
+        CHECK(buffer.pop() == 1);
+        CHECK(buffer.pop() == 2);
+        CHECK(buffer.size() == 1);
+    }
+
+    SECTION("push into full buffer evicts the oldest item")
+    {
+        buffer.push(4);
+        buffer.push(5);
+        buffer.push(6);
+
+        REQUIRE(buffer.full());
+        CHECK(buffer[0] == 3);
+        CHECK(buffer[1] == 4);
+        CHECK(buffer[2] == 5);
+        CHECK(buffer[3] == 6);
+    }
+}
+
+TEST_CASE("RingBuffer - windowed aggregates")
+{
+    RingBuffer<uint8_t, 4> buffer;
+
+    for (uint8_t value : {200, 100, 250, 50})
+        buffer.push(value);
+
+    static_assert(std::is_same_v<decltype(buffer.sum()), AccumulationTraits<uint8_t>::AccumulatorType>);
+    CHECK(buffer.sum() == 600); // no uint8_t overflow
+    CHECK(buffer.min() == 50);
+    CHECK(buffer.max() == 250);
+    CHECK(buffer.mean() == 150.0);
+
+    buffer.push(10); // evicts 200
+
+    CHECK(buffer.sum() == 410);
+    CHECK(buffer.min() == 10);
+    CHECK(buffer.max() == 250);
+
+    buffer.pop(); // 100
+    buffer.pop(); // 250
+
+    CHECK(buffer.sum() == 60);
+    CHECK(buffer.min() == 10);
+    CHECK(buffer.max() == 50);
+}
+
+TEST_CASE("RingBuffer - aggregates match full rescan")
+{
+    std::mt19937 rnd{42};
+    std::uniform_int_distribution<int> distr(-1'000, 1'000);
+
+    RingBuffer<int, 16> buffer;
+    std::deque<int> window;
+
+    for (int i = 0; i < 1'000; ++i)
+    {
+        const int value = distr(rnd);
+        buffer.push(value);
+        window.push_back(value);
+        if (window.size() > 16)
+            window.pop_front();
+
+        if (i % 7 == 0)
+        {
+            buffer.pop();
+            window.pop_front();
+        }
+
+        if (window.empty())
+            continue;
+
+        REQUIRE(buffer.size() == window.size());
+        REQUIRE(buffer.sum() == std::accumulate(window.begin(), window.end(), 0L));
+        REQUIRE(buffer.min() == *std::min_element(window.begin(), window.end()));
+        REQUIRE(buffer.max() == *std::max_element(window.begin(), window.end()));
+    }
+}
+
+TEST_CASE("RingBuffer - incremental vs. full-rescan aggregates", "[.][benchmark]")
+{
+    constexpr size_t window_size = 1024;
+
+    std::mt19937 rnd{665};
+    std::uniform_real_distribution<double> distr(0.1, 250.0);
+    std::vector<double> samples(100'000);
+    std::generate(samples.begin(), samples.end(), [&] { return distr(rnd); });
+
+    BENCHMARK("full rescan of std::vector")
+    {
+        std::vector<double> window;
+        double checksum = 0.0;
+
+        for (double sample : samples)
+        {
+            if (window.size() == window_size)
+                window.erase(window.begin());
+            window.push_back(sample);
+
+            const auto [min, max] = std::minmax_element(window.begin(), window.end());
+            const double mean = Step5::accumulate(window.data(), window.data() + window.size()) / window.size();
+            checksum += *min + *max + mean;
+        }
+
+        return checksum;
+    };
+
+    BENCHMARK("incremental RingBuffer")
+    {
+        auto window = std::make_unique<RingBuffer<double, window_size>>();
+        double checksum = 0.0;
+
+        for (double sample : samples)
+        {
+            window->push(sample);
+            checksum += window->min() + window->max() + window->mean();
+        }
+
+        return checksum;
+    };
+}
@@ -1,3 +1,6 @@
+#include "unroll.hpp"
+
+#include <array>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -6,15 +9,16 @@
 
 using namespace std::literals;
 
-template <auto N>
-constexpr auto unroll = [](auto expr)
-{
-    [expr]<auto... Is>(std::index_sequence<Is...>) {
-        ((expr(), void(Is)), ...);
-    }(std::make_index_sequence<N>{});
-};
-
 TEST_CASE("loop unrolling")
 {
     unroll<10>([] { std::cout << "Hello World!\n"; });
-}
\ No newline at end of file
+}
+
+TEST_CASE("loop unrolling - index of iteration")
+{
+    std::array<size_t, 5> squares{};
+
+    unroll<5>([&squares](auto i) { std::get<i>(squares) = i * i; });
+
+    REQUIRE(squares == std::array<size_t, 5>{0, 1, 4, 9, 16});
+}
@@ -0,0 +1,21 @@
+#ifndef METAPROGRAMMING_UNROLL_HPP
+#define METAPROGRAMMING_UNROLL_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+// calls expr N times without a loop - expr may take the index of the call
+// as std::integral_constant<size_t, I> (usable in constant expressions)
+template <auto N>
+constexpr auto unroll = [](auto expr)
+{
+    [&expr]<auto... Is>(std::index_sequence<Is...>) {
+        if constexpr (std::is_invocable_v<decltype(expr)&, std::integral_constant<size_t, 0>>)
+            (void(expr(std::integral_constant<size_t, Is>{})), ...);
+        else
+            ((expr(), void(Is)), ...);
+    }(std::make_index_sequence<N>{});
+};
+
+#endif
@@ -0,0 +1,250 @@
+#ifndef TRAITS_AND_POLICIES_ACCUMULATE_HPP
+#define TRAITS_AND_POLICIES_ACCUMULATE_HPP
+
+#include "execution.hpp"
+#include "simd_sum.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+inline namespace Step5
+{
+    template <typename T>
+    struct AccumulationTraits;
+
+    template <>
+    struct AccumulationTraits<uint8_t>
+    {
+        typedef unsigned int AccumulatorType;
+        static constexpr AccumulatorType const zero = 0;
+    };
+
+    template <>
+    struct AccumulationTraits<int>
+    {
+        typedef long AccumulatorType;
+        static constexpr AccumulatorType zero = 0;
+    };
+
+    template <>
+    struct AccumulationTraits<float>
+    {
+        typedef double AccumulatorType;
+        static constexpr AccumulatorType zero = 0.0;
+    };
+
+    template <>
+    struct AccumulationTraits<double>
+    {
+        typedef double AccumulatorType;
+        static constexpr AccumulatorType zero = 0.0;
+    };
+
+    struct SumPolicy
+    {
+        template <typename T1, typename T2>
+        static void accumulate(T1& total, const T2& value)
+        {
+            total += value;
+        }
+
+        template <typename T>
+        static void combine(T& total, const T& partial)
+        {
+            total += partial;
+        }
+    };
+
+    template <typename TPolicy, typename TAccumulator>
+    concept CombinablePolicy = requires(TAccumulator& total, const TAccumulator& partial) {
+        TPolicy::combine(total, partial);
+    };
+
+    // smaller chunks are not worth waking up another thread
+    inline constexpr size_t min_parallel_chunk_size = 64 * 1024;
+
+    template <typename T, typename AccumulationPolicy = SumPolicy, typename Traits = AccumulationTraits<T>,
+        typename ExecutionPolicy = SequentialExecution>
+    typename Traits::AccumulatorType accumulate(T const* begin, T const* end)
+    {
+        using AccT = typename Traits::AccumulatorType;
+
+        if constexpr (ExecutionPolicy::is_parallel)
+        {
+            // each chunk starts from Traits::zero - it must be an identity of combine()
+            static_assert(CombinablePolicy<AccumulationPolicy, AccT>, "parallel accumulate requires AccumulationPolicy::combine()");
+
+            const size_t size = static_cast<size_t>(end - begin);
+            const size_t chunk_count = std::clamp<size_t>(size / min_parallel_chunk_size, 1, ExecutionPolicy::chunk_count());
+
+            if (chunk_count == 1)
+                return accumulate<T, AccumulationPolicy, Traits>(begin, end);
+
+            std::vector<AccT> partials(chunk_count, Traits::zero);
+
+            ExecutionPolicy::run(chunk_count, [&](size_t i) {
+                partials[i] = accumulate<T, AccumulationPolicy, Traits>(begin + size * i / chunk_count, begin + size * (i + 1) / chunk_count);
+            });
+
+            AccT total = Traits::zero;
+            for (const auto& partial : partials)
+                AccumulationPolicy::combine(total, partial);
+
+            return total;
+        }
+        // summing contiguous data - vectorized kernel is selected if available
+        else if constexpr (std::is_same_v<AccumulationPolicy, SumPolicy> && SimdSum::HasKernel<T, AccT>)
+        {
+            return static_cast<AccT>(Traits::zero + static_cast<AccT>(SimdSum::sum(begin, end)));
+        }
+        else
+        {
+            AccT total = Traits::zero;
+
+            while (begin != end)
+            {
+                AccumulationPolicy::accumulate(total, *begin);
+                ++begin;
+            }
+
+            return total;
+        }
+    }
+} // namespace Step5
+
+struct MultiplyAccumulationTraits
+{
+    typedef unsigned int AccumulatorType;
+    static constexpr AccumulatorType const zero = 1;
+};
+
+struct MultiplyPolicy
+{
+    template <typename T1, typename T2>
+    static void accumulate(T1& total, const T2& value)
+    {
+        total *= value;
+    }
+
+    template <typename T>
+    static void combine(T& total, const T& partial)
+    {
+        total *= partial;
+    }
+};
+
+template <typename T>
+struct MinAccumulationTraits
+{
+    typedef T AccumulatorType;
+    static constexpr AccumulatorType zero = std::numeric_limits<T>::max();
+};
+
+struct MinPolicy
+{
+    template <typename T1, typename T2>
+    static void accumulate(T1& total, const T2& value)
+    {
+        total = value < total ? value : total;
+    }
+
+    template <typename T>
+    static void combine(T& total, const T& partial)
+    {
+        accumulate(total, partial);
+    }
+};
+
+template <typename T>
+struct MaxAccumulationTraits
+{
+    typedef T AccumulatorType;
+    static constexpr AccumulatorType zero = std::numeric_limits<T>::lowest();
+};
+
+struct MaxPolicy
+{
+    template <typename T1, typename T2>
+    static void accumulate(T1& total, const T2& value)
+    {
+        total = total < value ? value : total;
+    }
+
+    template <typename T>
+    static void combine(T& total, const T& partial)
+    {
+        accumulate(total, partial);
+    }
+};
+
+struct CountAccumulationTraits
+{
+    typedef size_t AccumulatorType;
+    static constexpr AccumulatorType zero = 0;
+};
+
+struct CountPolicy
+{
+    template <typename T1, typename T2>
+    static void accumulate(T1& total, const T2&)
+    {
+        ++total;
+    }
+
+    template <typename T>
+    static void combine(T& total, const T& partial)
+    {
+        total += partial;
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// fused accumulate - many reductions in a single pass over memory
+//
+// Reduction<Policy, Traits> pairs a policy with its traits; without Traits
+// AccumulationTraits of the element type are used.
+//
+template <typename AccumulationPolicy, typename Traits = void>
+struct Reduction
+{
+    using Policy = AccumulationPolicy;
+
+    template <typename T>
+    using TraitsFor = std::conditional_t<std::is_void_v<Traits>, AccumulationTraits<T>, Traits>;
+};
+
+template <typename T>
+constexpr bool is_reduction_v = false;
+
+template <typename AccumulationPolicy, typename Traits>
+constexpr bool is_reduction_v<Reduction<AccumulationPolicy, Traits>> = true;
+
+inline namespace Step5
+{
+    template <typename... Reductions, typename T>
+        requires(sizeof...(Reductions) > 0 && (is_reduction_v<Reductions> && ...))
+    auto accumulate(T const* begin, T const* end)
+    {
+        std::tuple<typename Reductions::template TraitsFor<T>::AccumulatorType...> totals{
+            Reductions::template TraitsFor<T>::zero...};
+
+        [&]<size_t... Is>(std::index_sequence<Is...>) {
+            while (begin != end)
+            {
+                const T& value = *begin;
+                (..., Reductions::Policy::accumulate(std::get<Is>(totals), value));
+                ++begin;
+            }
+        }(std::index_sequence_for<Reductions...>{});
+
+        return totals;
+    }
+} // namespace Step5
+
+#endif
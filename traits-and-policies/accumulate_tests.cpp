@@ -0,0 +1,296 @@
+#include "accumulate.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // same behaviour as SumPolicy, but a different type - forces the scalar loop
+    struct ScalarSumPolicy : SumPolicy
+    {
+    };
+
+    template <typename T>
+    std::vector<T> random_values(size_t size, unsigned seed = 42)
+    {
+        std::mt19937_64 rnd{seed};
+        std::vector<T> data(size);
+
+        for (auto& item : data)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                item = static_cast<T>(std::uniform_real_distribution<double>(-100.0, 100.0)(rnd));
+            else
+                item = static_cast<T>(rnd());
+        }
+
+        return data;
+    }
+
+    template <typename T, typename TAction>
+    void for_sizes(TAction action)
+    {
+        for (size_t size : {0, 1, 7, 63, 64, 65, 1'000, 100'003})
+        {
+            const auto data = random_values<T>(size);
+            action(data.data(), data.data() + data.size());
+        }
+    }
+} // namespace
+
+TEST_CASE("accumulate with SumPolicy - vectorized kernels are selected")
+{
+    static_assert(SimdSum::HasKernel<uint8_t, AccumulationTraits<uint8_t>::AccumulatorType>);
+    static_assert(SimdSum::HasKernel<int, AccumulationTraits<int>::AccumulatorType>);
+    static_assert(SimdSum::HasKernel<float, AccumulationTraits<float>::AccumulatorType>);
+    static_assert(SimdSum::HasKernel<double, AccumulationTraits<double>::AccumulatorType>);
+    static_assert(!SimdSum::HasKernel<uint8_t, bool>);
+}
+
+TEST_CASE("accumulate with SumPolicy - integer results match scalar loop exactly")
+{
+    SECTION("uint8_t")
+    {
+        for_sizes<uint8_t>([](const uint8_t* begin, const uint8_t* end) {
+            REQUIRE(Step5::accumulate(begin, end) == Step5::accumulate<uint8_t, ScalarSumPolicy>(begin, end));
+        });
+    }
+
+    SECTION("int")
+    {
+        for_sizes<int>([](const int* begin, const int* end) {
+            REQUIRE(Step5::accumulate(begin, end) == Step5::accumulate<int, ScalarSumPolicy>(begin, end));
+        });
+    }
+
+    SECTION("uint8_t - 1 + 2 + ... + 255")
+    {
+        uint8_t data[255];
+        std::iota(std::begin(data), std::end(data), 1);
+
+        CHECK(Step5::accumulate(std::begin(data), std::end(data)) == 32640);
+    }
+}
+
+TEST_CASE("accumulate with SumPolicy - floating point results")
+{
+    using Catch::Matchers::WithinRel;
+
+    SECTION("float")
+    {
+        for_sizes<float>([](const float* begin, const float* end) {
+            REQUIRE_THAT(Step5::accumulate(begin, end), WithinRel(Step5::accumulate<float, ScalarSumPolicy>(begin, end), 1e-9));
+        });
+    }
+
+    SECTION("double")
+    {
+        for_sizes<double>([](const double* begin, const double* end) {
+            REQUIRE_THAT(Step5::accumulate(begin, end), WithinRel(Step5::accumulate<double, ScalarSumPolicy>(begin, end), 1e-9));
+        });
+    }
+}
+
+namespace
+{
+    template <typename T, typename TPolicy>
+    double throughput_gb_per_s(const std::vector<T>& data, int repeats)
+    {
+        volatile auto sink = Step5::accumulate<T, TPolicy>(data.data(), data.data() + data.size()); // warm-up
+
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < repeats; ++i)
+            sink = Step5::accumulate<T, TPolicy>(data.data(), data.data() + data.size());
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        (void)sink;
+
+        return static_cast<double>(data.size() * sizeof(T)) * repeats / elapsed.count() / 1e9;
+    }
+
+    template <typename T>
+    void report_throughput(const std::string& type_name)
+    {
+        for (size_t megabytes : {1, 16, 256, 1024})
+        {
+            const auto data = random_values<T>(megabytes * 1024 * 1024 / sizeof(T));
+            const int repeats = static_cast<int>(std::max<size_t>(1, 2048 / megabytes));
+
+            std::cout << type_name << " - " << megabytes << " MB: scalar "
+                      << throughput_gb_per_s<T, ScalarSumPolicy>(data, repeats) << " GB/s, vectorized "
+                      << throughput_gb_per_s<T, SumPolicy>(data, repeats) << " GB/s\n";
+        }
+    }
+} // namespace
+
+TEST_CASE("accumulate with SumPolicy - throughput", "[.][benchmark]")
+{
+    report_throughput<uint8_t>("uint8_t");
+    report_throughput<int>("int");
+    report_throughput<float>("float");
+    report_throughput<double>("double");
+}
+
+TEST_CASE("accumulate - parallel execution policies")
+{
+    const auto data = random_values<int>(1'000'003);
+    const int* first = data.data();
+    const int* last = data.data() + data.size();
+
+    const auto expected = Step5::accumulate(first, last);
+
+    SECTION("chunked parallel")
+    {
+        CHECK(Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, ChunkedParallelExecution<1>>(first, last) == expected);
+        CHECK(Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, ChunkedParallelExecution<4>>(first, last) == expected);
+        CHECK(Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, ChunkedParallelExecution<>>(first, last) == expected);
+    }
+
+    SECTION("thread pool")
+    {
+        CHECK(Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, ThreadPoolExecution>(first, last) == expected);
+    }
+
+    SECTION("partials of MultiplyPolicy are multiplied")
+    {
+        const auto factors = random_values<uint8_t>(1'000'003, 665);
+
+        const auto product = Step5::accumulate<uint8_t, MultiplyPolicy, MultiplyAccumulationTraits>(factors.data(), factors.data() + factors.size());
+        const auto parallel_product = Step5::accumulate<uint8_t, MultiplyPolicy, MultiplyAccumulationTraits, ChunkedParallelExecution<8>>(
+            factors.data(), factors.data() + factors.size());
+
+        CHECK(parallel_product == product);
+    }
+
+    SECTION("small ranges are reduced on the calling thread")
+    {
+        CHECK(Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, ThreadPoolExecution>(first, first + 10)
+            == Step5::accumulate(first, first + 10));
+    }
+}
+
+TEST_CASE("execution policies - exceptions and nesting")
+{
+    const auto throw_in_chunk_1 = [](size_t i) {
+        if (i == 1)
+            throw std::runtime_error{"chunk 1"};
+    };
+
+    SECTION("chunked parallel rethrows after all chunks finished")
+    {
+        std::atomic<size_t> finished{0};
+
+        REQUIRE_THROWS_AS(ChunkedParallelExecution<4>::run(4, [&](size_t i) {
+            throw_in_chunk_1(i);
+            ++finished;
+        }), std::runtime_error);
+        CHECK(finished == 3);
+    }
+
+    SECTION("no chunks - f is never called")
+    {
+        bool called = false;
+
+        ChunkedParallelExecution<4>::run(0, [&](size_t) { called = true; });
+        ThreadPoolExecution::run(0, [&](size_t) { called = true; });
+
+        CHECK_FALSE(called);
+    }
+
+    SECTION("thread pool rethrows")
+    {
+        REQUIRE_THROWS_AS(ThreadPoolExecution::run(4, throw_in_chunk_1), std::runtime_error);
+    }
+
+    SECTION("nested call from a task of the pool runs inline")
+    {
+        const size_t count = ThreadPool::instance().size() + 1;
+        std::atomic<size_t> calls{0};
+
+        ThreadPoolExecution::run(count, [&](size_t) {
+            ThreadPoolExecution::run(count, [&](size_t) { ++calls; });
+        });
+
+        CHECK(calls == count * count);
+    }
+}
+
+namespace
+{
+    template <typename TExecution>
+    void report_scaling(const std::vector<int>& data, size_t threads)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        volatile auto sink = Step5::accumulate<int, SumPolicy, AccumulationTraits<int>, TExecution>(data.data(), data.data() + data.size());
+        const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        (void)sink;
+
+        std::cout << "threads: " << threads << " - " << elapsed.count() * 1000 << " ms, "
+                  << static_cast<double>(data.size() * sizeof(int)) / elapsed.count() / 1e9 << " GB/s\n";
+    }
+} // namespace
+
+TEST_CASE("accumulate - parallel scaling", "[.][benchmark]")
+{
+    const std::vector<int> data(size_t{2} * 1024 * 1024 * 1024 / sizeof(int), 1);
+
+    report_scaling<SequentialExecution>(data, 1);
+    report_scaling<ChunkedParallelExecution<2>>(data, 2);
+    report_scaling<ChunkedParallelExecution<4>>(data, 4);
+    report_scaling<ChunkedParallelExecution<8>>(data, 8);
+    report_scaling<ChunkedParallelExecution<16>>(data, 16);
+    report_scaling<ThreadPoolExecution>(data, ThreadPool::instance().size());
+}
+
+TEST_CASE("accumulate - fused reductions in a single pass")
+{
+    const auto data = random_values<int>(10'007);
+    const int* first = data.data();
+    const int* last = data.data() + data.size();
+
+    auto [sum, product, min, max, count] = Step5::accumulate<Reduction<SumPolicy>, Reduction<MultiplyPolicy, MultiplyAccumulationTraits>,
+        Reduction<MinPolicy, MinAccumulationTraits<int>>, Reduction<MaxPolicy, MaxAccumulationTraits<int>>, Reduction<CountPolicy, CountAccumulationTraits>>(first, last);
+
+    static_assert(std::is_same_v<decltype(sum), AccumulationTraits<int>::AccumulatorType>);
+    static_assert(std::is_same_v<decltype(count), size_t>);
+
+    CHECK(sum == Step5::accumulate(first, last));
+    CHECK(product == Step5::accumulate<int, MultiplyPolicy, MultiplyAccumulationTraits>(first, last));
+    CHECK(min == *std::min_element(first, last));
+    CHECK(max == *std::max_element(first, last));
+    CHECK(count == data.size());
+}
+
+TEST_CASE("accumulate - fused vs. separate passes", "[.][benchmark]")
+{
+    // much bigger than the last level cache - every pass streams from memory
+    const auto data = random_values<int>(64 * 1024 * 1024);
+    const int* first = data.data();
+    const int* last = data.data() + data.size();
+
+    BENCHMARK("5 separate passes")
+    {
+        return Step5::accumulate<int, ScalarSumPolicy>(first, last)
+            + Step5::accumulate<int, MultiplyPolicy, MultiplyAccumulationTraits>(first, last)
+            + Step5::accumulate<int, MinPolicy, MinAccumulationTraits<int>>(first, last)
+            + Step5::accumulate<int, MaxPolicy, MaxAccumulationTraits<int>>(first, last)
+            + Step5::accumulate<int, CountPolicy, CountAccumulationTraits>(first, last);
+    };
+
+    BENCHMARK("single fused pass")
+    {
+        const auto [sum, product, min, max, count] = Step5::accumulate<Reduction<ScalarSumPolicy>, Reduction<MultiplyPolicy, MultiplyAccumulationTraits>,
+            Reduction<MinPolicy, MinAccumulationTraits<int>>, Reduction<MaxPolicy, MaxAccumulationTraits<int>>, Reduction<CountPolicy, CountAccumulationTraits>>(first, last);
+
+        return sum + product + min + max + count;
+    };
+}
@@ -0,0 +1,43 @@
+#include "allocation_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    thread_local bool is_counting = false;
+    thread_local size_t allocation_count = 0;
+} // namespace
+
+void AllocationCounter::start()
+{
+    allocation_count = 0;
+    is_counting = true;
+}
+
+size_t AllocationCounter::stop()
+{
+    is_counting = false;
+    return allocation_count;
+}
+
+void* operator new(size_t size)
+{
+    if (is_counting)
+        ++allocation_count;
+
+    if (void* ptr = std::malloc(size ? size : 1))
+        return ptr;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void* ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void* ptr, size_t) noexcept
+{
+    std::free(ptr);
+}
@@ -0,0 +1,35 @@
+#ifndef TRAITS_AND_POLICIES_ALLOCATION_COUNTER_HPP
+#define TRAITS_AND_POLICIES_ALLOCATION_COUNTER_HPP
+
+#include <cstddef>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////
+// counting of heap allocations for tests
+//  - allocation_counter.cpp replaces global operator new, so it is linked once into a test binary
+//  - only calls made by the measuring thread inside count_allocations are counted,
+//    so allocations of thread pools running in other tests do not interfere
+
+namespace AllocationCounter
+{
+    void start();
+    size_t stop();
+} // namespace AllocationCounter
+
+template <typename F>
+size_t count_allocations(F&& f)
+{
+    AllocationCounter::start();
+    try
+    {
+        std::forward<F>(f)();
+    }
+    catch (...)
+    {
+        AllocationCounter::stop();
+        throw;
+    }
+    return AllocationCounter::stop();
+}
+
+#endif
@@ -0,0 +1,178 @@
+#ifndef TRAITS_AND_POLICIES_ANY_SERVICE_HPP
+#define TRAITS_AND_POLICIES_ANY_SERVICE_HPP
+
+#include "services.hpp"
+
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <new>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace StaticPoly
+{
+    /////////////////////////////////////////////////////////////////
+    // AnyService - value-semantic type erasure of any Service
+    //
+    // Services that fit into the inline buffer (and are nothrow movable)
+    // live inside the object - no heap allocation. Bigger ones are
+    // allocated on the heap. Calls go through a static table of function
+    // pointers generated per service type (one indirection, no RTTI).
+    //
+    class AnyService
+    {
+    public:
+        static constexpr size_t buffer_size = 3 * sizeof(void*);
+
+        template <typename TService>
+        static constexpr bool stored_inline = sizeof(TService) <= buffer_size
+            && alignof(TService) <= alignof(std::max_align_t)
+            && std::is_nothrow_move_constructible_v<TService>;
+
+        AnyService() = default;
+
+        template <typename TService>
+            requires(!std::same_as<std::remove_cvref_t<TService>, AnyService>
+                && Service<std::remove_cvref_t<TService>>
+                && std::copy_constructible<std::remove_cvref_t<TService>>)
+        AnyService(TService&& srv)
+            : vtable_{&vtable_for<std::remove_cvref_t<TService>>}
+        {
+            using T = std::remove_cvref_t<TService>;
+
+            if constexpr (stored_inline<T>)
+                ::new (buffer_) T(std::forward<TService>(srv));
+            else
+                *reinterpret_cast<T**>(buffer_) = new T(std::forward<TService>(srv));
+        }
+
+        AnyService(const AnyService& other)
+            : vtable_{other.vtable_}
+        {
+            if (vtable_)
+                vtable_->copy(other.buffer_, buffer_);
+        }
+
+        AnyService& operator=(const AnyService& other)
+        {
+            if (this != &other)
+            {
+                AnyService temp(other);
+                reset();
+                move_from(temp);
+            }
+            return *this;
+        }
+
+        AnyService(AnyService&& other) noexcept
+        {
+            move_from(other);
+        }
+
+        AnyService& operator=(AnyService&& other) noexcept
+        {
+            if (this != &other)
+            {
+                reset();
+                move_from(other);
+            }
+            return *this;
+        }
+
+        ~AnyService()
+        {
+            reset();
+        }
+
+        std::string run()
+        {
+            assert(vtable_ != nullptr);
+            return vtable_->run(buffer_);
+        }
+
+        bool has_value() const noexcept
+        {
+            return vtable_ != nullptr;
+        }
+
+        bool is_inline() const noexcept
+        {
+            return vtable_ && vtable_->is_inline;
+        }
+
+        void reset() noexcept
+        {
+            if (vtable_)
+                vtable_->destroy(buffer_);
+            vtable_ = nullptr;
+        }
+
+    private:
+        struct VTable
+        {
+            std::string (*run)(std::byte* buffer);
+            void (*copy)(const std::byte* source, std::byte* target);
+            void (*move)(std::byte* source, std::byte* target) noexcept;
+            void (*destroy)(std::byte* buffer) noexcept;
+            bool is_inline;
+        };
+
+        template <typename T>
+        static T* object(std::byte* buffer)
+        {
+            if constexpr (stored_inline<T>)
+                return std::launder(reinterpret_cast<T*>(buffer));
+            else
+                return *reinterpret_cast<T**>(buffer);
+        }
+
+        template <typename T>
+        static const T* object(const std::byte* buffer)
+        {
+            return object<T>(const_cast<std::byte*>(buffer));
+        }
+
+        template <typename T>
+        static constexpr VTable vtable_for = {
+            [](std::byte* buffer) -> std::string { return object<T>(buffer)->run(); },
+            [](const std::byte* source, std::byte* target) {
+                if constexpr (stored_inline<T>)
+                    ::new (target) T(*object<T>(source));
+                else
+                    *reinterpret_cast<T**>(target) = new T(*object<T>(source));
+            },
+            [](std::byte* source, std::byte* target) noexcept {
+                if constexpr (stored_inline<T>)
+                {
+                    ::new (target) T(std::move(*object<T>(source)));
+                    object<T>(source)->~T();
+                }
+                else
+                    *reinterpret_cast<T**>(target) = object<T>(source); // steals the pointer
+            },
+            [](std::byte* buffer) noexcept {
+                if constexpr (stored_inline<T>)
+                    object<T>(buffer)->~T();
+                else
+                    delete object<T>(buffer);
+            },
+            stored_inline<T>};
+
+        alignas(std::max_align_t) std::byte buffer_[buffer_size];
+        const VTable* vtable_{};
+
+        // other is left empty
+        void move_from(AnyService& other) noexcept
+        {
+            if (other.vtable_)
+                other.vtable_->move(other.buffer_, buffer_);
+            vtable_ = std::exchange(other.vtable_, nullptr);
+        }
+    };
+
+    static_assert(Service<AnyService>);
+} // namespace StaticPoly
+
+#endif
@@ -0,0 +1,171 @@
+#include "any_service.hpp"
+
+#include <array>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct BigService
+    {
+        std::array<char, 128> name{"BigService runs..."};
+
+        std::string run()
+        {
+            return name.data();
+        }
+    };
+
+    struct CountingService
+    {
+        int* counter;
+
+        std::string run()
+        {
+            return std::to_string(++*counter);
+        }
+    };
+} // namespace
+
+using StaticPoly::AnyService;
+
+TEST_CASE("AnyService - small services are stored inline")
+{
+    STATIC_REQUIRE(AnyService::stored_inline<StaticPoly::AService>);
+    STATIC_REQUIRE(AnyService::stored_inline<CountingService>);
+    STATIC_REQUIRE_FALSE(AnyService::stored_inline<BigService>);
+    STATIC_REQUIRE(StaticPoly::Service<AnyService>);
+
+    AnyService srv = StaticPoly::AService{};
+
+    CHECK(srv.is_inline());
+    CHECK(srv.run() == "AService runs...");
+}
+
+TEST_CASE("AnyService - big services are stored on heap")
+{
+    AnyService srv = BigService{};
+
+    CHECK_FALSE(srv.is_inline());
+    CHECK(srv.run() == "BigService runs...");
+}
+
+TEST_CASE("AnyService - value semantics")
+{
+    AnyService srv;
+    CHECK_FALSE(srv.has_value());
+
+    SECTION("copy")
+    {
+        int counter = 0;
+        srv = CountingService{&counter};
+        srv.run();
+
+        AnyService copy = srv;
+        CHECK(copy.run() == "2");
+        CHECK(srv.run() == "3");
+
+        AnyService big = BigService{};
+        AnyService big_copy = big;
+        big = StaticPoly::AnotherService{};
+        CHECK(big.run() == "AnotherService runs...");
+        CHECK(big_copy.run() == "BigService runs...");
+    }
+
+    SECTION("move")
+    {
+        srv = BigService{};
+
+        AnyService target = std::move(srv);
+        CHECK_FALSE(srv.has_value());
+        CHECK(target.run() == "BigService runs...");
+
+        target = AnyService{StaticPoly::AService{}};
+        CHECK(target.run() == "AService runs...");
+    }
+
+    SECTION("containers")
+    {
+        std::vector<AnyService> services = {StaticPoly::AService{}, BigService{}, StaticPoly::AnotherService{}};
+        services.reserve(100); // relocation
+
+        CHECK(services[0].run() == "AService runs...");
+        CHECK(services[1].run() == "BigService runs...");
+        CHECK(services[2].run() == "AnotherService runs...");
+    }
+
+    SECTION("used by StaticPoly::User")
+    {
+        StaticPoly::User<AnyService> user{StaticPoly::AnotherService{}};
+        user.use();
+    }
+}
+
+TEST_CASE("AnyService vs. unique_ptr<Service> vs. static polymorphism", "[.][benchmark]")
+{
+    const size_t size = 1'000;
+
+    BENCHMARK("construction - DynamicPoly::User")
+    {
+        std::vector<DynamicPoly::User> users;
+        users.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            users.emplace_back(std::make_unique<DynamicPoly::AService>());
+        return users;
+    };
+
+    BENCHMARK("construction - StaticPoly::User")
+    {
+        std::vector<StaticPoly::User<StaticPoly::AService>> users;
+        users.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            users.emplace_back(StaticPoly::AService{});
+        return users;
+    };
+
+    BENCHMARK("construction - StaticPoly::User<AnyService>")
+    {
+        std::vector<StaticPoly::User<AnyService>> users;
+        users.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            users.emplace_back(StaticPoly::AService{});
+        return users;
+    };
+
+    // User::use() writes to std::cout - calls are measured on the services themselves
+    std::vector<std::unique_ptr<DynamicPoly::Service>> dynamic_services;
+    std::vector<StaticPoly::AService> static_services(size);
+    std::vector<AnyService> any_services;
+    for (size_t i = 0; i < size; ++i)
+    {
+        dynamic_services.push_back(std::make_unique<DynamicPoly::AService>());
+        any_services.emplace_back(StaticPoly::AService{});
+    }
+
+    BENCHMARK("run - unique_ptr<DynamicPoly::Service>")
+    {
+        size_t length = 0;
+        for (auto& srv : dynamic_services)
+            length += srv->run().size();
+        return length;
+    };
+
+    BENCHMARK("run - StaticPoly::AService")
+    {
+        size_t length = 0;
+        for (auto& srv : static_services)
+            length += srv.run().size();
+        return length;
+    };
+
+    BENCHMARK("run - AnyService")
+    {
+        size_t length = 0;
+        for (auto& srv : any_services)
+            length += srv.run().size();
+        return length;
+    };
+}
@@ -0,0 +1,110 @@
+#ifndef TRAITS_AND_POLICIES_EXECUTION_HPP
+#define TRAITS_AND_POLICIES_EXECUTION_HPP
+
+#include "thread_pool.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// ExecutionPolicy - how chunks of a reduction are scheduled
+//
+// A parallel policy provides chunk_count() and run(count, f), which calls
+// f(0), ..., f(count - 1) concurrently and returns when all calls are done.
+//
+struct SequentialExecution
+{
+    static constexpr bool is_parallel = false;
+};
+
+/////////////////////////////////////////////////////////////////
+// ExecutionPolicy
+//
+struct ThreadPoolExecution
+{
+    static constexpr bool is_parallel = true;
+
+    static size_t chunk_count()
+    {
+        return ThreadPool::instance().size();
+    }
+
+    // a nested call from a task of the pool runs inline - waiting for the pool
+    // from all of its workers would deadlock
+    template <typename F>
+    static void run(size_t count, const F& f)
+    {
+        if (ThreadPool::instance().is_worker_thread())
+        {
+            for (size_t i = 0; i < count; ++i)
+                f(i);
+            return;
+        }
+
+        std::vector<std::future<void>> results;
+        results.reserve(count);
+
+        for (size_t i = 0; i < count; ++i)
+            results.push_back(ThreadPool::instance().submit([&f, i] { f(i); }));
+
+        // all tasks must finish before f goes out of scope - only then the first exception is rethrown
+        for (auto& result : results)
+            result.wait();
+        for (auto& result : results)
+            result.get();
+    }
+};
+
+/////////////////////////////////////////////////////////////////
+// ExecutionPolicy - one thread per chunk (0 - as many as hardware threads)
+//
+template <size_t ThreadCount = 0>
+struct ChunkedParallelExecution
+{
+    static constexpr bool is_parallel = true;
+
+    static size_t chunk_count()
+    {
+        return ThreadCount != 0 ? ThreadCount : ThreadPool::default_size();
+    }
+
+    // exceptions are caught per chunk - after all threads are joined the first one is rethrown
+    template <typename F>
+    static void run(size_t count, const F& f)
+    {
+        if (count == 0)
+            return;
+
+        std::vector<std::exception_ptr> errors(count);
+
+        auto run_chunk = [&f, &errors](size_t i) {
+            try
+            {
+                f(i);
+            }
+            catch (...)
+            {
+                errors[i] = std::current_exception();
+            }
+        };
+
+        {
+            std::vector<std::jthread> threads;
+            threads.reserve(count - 1);
+
+            for (size_t i = 0; i + 1 < count; ++i)
+                threads.emplace_back(run_chunk, i);
+
+            run_chunk(count - 1); // the calling thread takes the last chunk
+        }
+
+        for (const auto& error : errors)
+            if (error)
+                std::rethrow_exception(error);
+    }
+};
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef TRAITS_AND_POLICIES_MAPPED_FILE_HPP
+#define TRAITS_AND_POLICIES_MAPPED_FILE_HPP
+
+#include "accumulate.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define TRAITS_AND_POLICIES_HAS_MMAP
+#endif
+
+// 64 MB - big enough to amortize a syscall, small enough to stay resident in RAM
+inline constexpr size_t default_file_chunk_size = 64 * 1024 * 1024;
+
+#ifdef TRAITS_AND_POLICIES_HAS_MMAP
+
+/////////////////////////////////////////////////////////////////
+// MappedFile - read-only memory mapping of a binary file of T items
+//
+// The mapping is advised as sequential, so the kernel reads ahead. Chunks
+// visited by for_each_chunk() are dropped from the process after use, which
+// keeps resident memory bounded by the chunk size (plus read-ahead).
+// Trailing bytes that do not form a whole T are ignored.
+//
+template <typename T>
+class MappedFile
+{
+    static_assert(std::is_trivially_copyable_v<T>);
+
+public:
+    explicit MappedFile(const std::filesystem::path& path)
+    {
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd == -1)
+            throw std::system_error(errno, std::generic_category(), "cannot open " + path.string());
+
+        struct stat file_stat{};
+        if (::fstat(fd, &file_stat) == -1)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw std::system_error(error, std::generic_category(), "cannot stat " + path.string());
+        }
+
+        length_ = static_cast<size_t>(file_stat.st_size);
+
+        if (length_ > 0)
+        {
+            void* address = ::mmap(nullptr, length_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (address == MAP_FAILED)
+            {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "cannot map " + path.string());
+            }
+
+            if (::madvise(address, length_, MADV_SEQUENTIAL) == -1)
+            {
+                const int error = errno;
+                ::munmap(address, length_);
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "cannot advise mapping of " + path.string());
+            }
+
+            address_ = address;
+        }
+
+        ::close(fd); // the mapping keeps the file referenced
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    MappedFile(MappedFile&& other) noexcept
+        : address_{std::exchange(other.address_, nullptr)}
+        , length_{std::exchange(other.length_, 0)}
+    {
+    }
+
+    MappedFile& operator=(MappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            unmap();
+            address_ = std::exchange(other.address_, nullptr);
+            length_ = std::exchange(other.length_, 0);
+        }
+        return *this;
+    }
+
+    ~MappedFile()
+    {
+        unmap();
+    }
+
+    size_t size() const
+    {
+        return length_ / sizeof(T);
+    }
+
+    const T* data() const
+    {
+        return static_cast<const T*>(address_);
+    }
+
+    std::span<const T> items() const
+    {
+        return {data(), size()};
+    }
+
+    // calls f(const T* begin, const T* end) for consecutive chunks of chunk_size bytes
+    template <typename F>
+    void for_each_chunk(F&& f, size_t chunk_size = default_file_chunk_size) const
+    {
+        const size_t page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+        // at least one item - a T larger than a page would otherwise give empty chunks forever
+        const size_t items_per_chunk = std::max<size_t>(1, std::max(page_size, chunk_size - chunk_size % page_size) / sizeof(T));
+
+        // madvise requires a page-aligned address - only whole pages below the end of a chunk are released,
+        // a page shared with the next chunk is released together with it
+        size_t released = 0;
+
+        for (size_t first = 0; first < size(); first += items_per_chunk)
+        {
+            const size_t last = std::min(size(), first + items_per_chunk);
+            f(data() + first, data() + last);
+
+            const size_t end = last == size() ? length_ : last * sizeof(T) - last * sizeof(T) % page_size;
+            if (end > released)
+            {
+                // pages of a private read-only mapping are reloaded from the file if touched again
+                if (::madvise(static_cast<char*>(address_) + released, end - released, MADV_DONTNEED) == -1)
+                    throw std::system_error(errno, std::generic_category(), "cannot release mapped pages");
+                released = end;
+            }
+        }
+    }
+
+private:
+    void* address_{};
+    size_t length_{};
+
+    void unmap()
+    {
+        if (address_)
+            ::munmap(address_, length_);
+    }
+};
+
+#endif
+
+/////////////////////////////////////////////////////////////////
+// accumulate_file - accumulation of a binary file of T items
+//
+// Chunks are accumulated separately and merged with AccumulationPolicy::combine(),
+// so the whole file is never resident in memory at once. Without mmap (e.g. on
+// Windows) the file is streamed through a buffer of the same size.
+//
+template <typename T, typename AccumulationPolicy = SumPolicy, typename Traits = AccumulationTraits<T>>
+typename Traits::AccumulatorType accumulate_file(const std::filesystem::path& path, size_t chunk_size = default_file_chunk_size)
+{
+    using AccT = typename Traits::AccumulatorType;
+
+    static_assert(CombinablePolicy<AccumulationPolicy, AccT>, "accumulate_file requires AccumulationPolicy::combine()");
+
+    AccT total = Traits::zero;
+    auto accumulate_chunk = [&total](const T* begin, const T* end) {
+        AccumulationPolicy::combine(total, Step5::accumulate<T, AccumulationPolicy, Traits>(begin, end));
+    };
+
+#ifdef TRAITS_AND_POLICIES_HAS_MMAP
+    MappedFile<T>{path}.for_each_chunk(accumulate_chunk, chunk_size);
+#else
+    std::ifstream file{path, std::ios::binary};
+    if (!file)
+        throw std::system_error(std::make_error_code(std::errc::no_such_file_or_directory), "cannot open " + path.string());
+
+    std::vector<T> buffer(std::max<size_t>(1, chunk_size / sizeof(T)));
+    while (file.read(reinterpret_cast<char*>(buffer.data()), buffer.size() * sizeof(T)) || file.gcount() > 0)
+    {
+        const size_t count = static_cast<size_t>(file.gcount()) / sizeof(T);
+        accumulate_chunk(buffer.data(), buffer.data() + count);
+    }
+#endif
+
+    return total;
+}
+
+#endif
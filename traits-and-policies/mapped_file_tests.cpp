@@ -0,0 +1,186 @@
+#include "mapped_file.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <filesystem>
+#include <fstream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    // binary file removed at the end of the scope
+    class TempFile
+    {
+        std::filesystem::path path_;
+
+    public:
+        template <typename T>
+        TempFile(const std::string& name, const std::vector<T>& items)
+            : path_{std::filesystem::temp_directory_path() / name}
+        {
+            std::ofstream out{path_, std::ios::binary};
+            out.write(reinterpret_cast<const char*>(items.data()), static_cast<std::streamsize>(items.size() * sizeof(T)));
+        }
+
+        TempFile(const TempFile&) = delete;
+        TempFile& operator=(const TempFile&) = delete;
+
+        ~TempFile()
+        {
+            std::error_code ec;
+            std::filesystem::remove(path_, ec);
+        }
+
+        const std::filesystem::path& path() const
+        {
+            return path_;
+        }
+    };
+
+    template <typename T>
+    std::vector<T> read_into_vector(const std::filesystem::path& path)
+    {
+        std::ifstream in{path, std::ios::binary};
+        std::vector<T> items(std::filesystem::file_size(path) / sizeof(T));
+        in.read(reinterpret_cast<char*>(items.data()), static_cast<std::streamsize>(items.size() * sizeof(T)));
+        return items;
+    }
+} // namespace
+
+TEST_CASE("accumulate_file - same result as accumulate over vector")
+{
+    std::mt19937 rnd{42};
+
+    SECTION("uint8_t")
+    {
+        std::vector<uint8_t> items(1'000'003);
+        std::generate(items.begin(), items.end(), [&] { return static_cast<uint8_t>(rnd()); });
+        TempFile file{"accumulate_file_uint8.bin", items};
+
+        CHECK(accumulate_file<uint8_t>(file.path(), 4096) == Step5::accumulate(items.data(), items.data() + items.size()));
+    }
+
+    SECTION("int32_t")
+    {
+        std::vector<int32_t> items(250'001);
+        std::generate(items.begin(), items.end(), [&] { return static_cast<int32_t>(rnd()); });
+        TempFile file{"accumulate_file_int32.bin", items};
+
+        CHECK(accumulate_file<int32_t>(file.path(), 64 * 1024) == Step5::accumulate(items.data(), items.data() + items.size()));
+        CHECK(accumulate_file<int32_t, MaxPolicy, MaxAccumulationTraits<int32_t>>(file.path()) == *std::max_element(items.begin(), items.end()));
+    }
+
+    SECTION("float")
+    {
+        std::vector<float> items(100'000);
+        std::generate(items.begin(), items.end(), [&] { return std::uniform_real_distribution<float>(0.0f, 1.0f)(rnd); });
+        TempFile file{"accumulate_file_float.bin", items};
+
+        CHECK_THAT(accumulate_file<float>(file.path(), 4096), Catch::Matchers::WithinRel(Step5::accumulate(items.data(), items.data() + items.size()), 1e-12));
+    }
+
+    SECTION("empty file")
+    {
+        TempFile file{"accumulate_file_empty.bin", std::vector<int>{}};
+
+        CHECK(accumulate_file<int>(file.path()) == 0);
+    }
+
+    SECTION("missing file")
+    {
+        REQUIRE_THROWS_AS(accumulate_file<int>(std::filesystem::temp_directory_path() / "no-such-file.bin"), std::system_error);
+    }
+}
+
+#ifdef TRAITS_AND_POLICIES_HAS_MMAP
+TEST_CASE("MappedFile - items are visible in chunks")
+{
+    std::vector<int> items(10'000);
+    std::iota(items.begin(), items.end(), 0);
+    TempFile file{"mapped_file_chunks.bin", items};
+
+    MappedFile<int> mapped{file.path()};
+    REQUIRE(mapped.size() == items.size());
+    CHECK(std::equal(items.begin(), items.end(), mapped.items().begin()));
+
+    std::vector<int> copied;
+    size_t chunk_count = 0;
+    mapped.for_each_chunk([&](const int* begin, const int* end) { copied.insert(copied.end(), begin, end); ++chunk_count; }, 4096);
+
+    CHECK(copied == items);
+    CHECK(chunk_count == 10);
+}
+
+namespace
+{
+    struct Point3D
+    {
+        int x, y, z;
+
+        bool operator==(const Point3D&) const = default;
+    };
+} // namespace
+
+TEST_CASE("MappedFile - chunks of items not dividing the page size")
+{
+    std::vector<Point3D> items(10'000);
+    for (int i = 0; auto& item : items)
+        item = {i, i + 1, ++i};
+    TempFile file{"mapped_file_points.bin", items};
+
+    MappedFile<Point3D> mapped{file.path()};
+
+    // chunk boundaries (multiples of 4096 / 12 items) are not page-aligned
+    std::vector<Point3D> copied;
+    mapped.for_each_chunk([&](const Point3D* begin, const Point3D* end) { copied.insert(copied.end(), begin, end); }, 4096);
+
+    CHECK(copied == items);
+}
+
+TEST_CASE("MappedFile - items larger than a page")
+{
+    struct Block
+    {
+        char bytes[3 * 4096 + 1];
+
+        bool operator==(const Block&) const = default;
+    };
+
+    std::vector<Block> items(5);
+    for (size_t i = 0; i < items.size(); ++i)
+        std::fill(std::begin(items[i].bytes), std::end(items[i].bytes), static_cast<char>('a' + i));
+    TempFile file{"mapped_file_blocks.bin", items};
+
+    MappedFile<Block> mapped{file.path()};
+
+    std::vector<Block> copied;
+    size_t chunk_count = 0;
+    mapped.for_each_chunk([&](const Block* begin, const Block* end) { copied.insert(copied.end(), begin, end); ++chunk_count; }, 4096);
+
+    CHECK(copied == items);
+    CHECK(chunk_count == items.size());
+}
+#endif
+
+TEST_CASE("accumulate_file vs. read into vector", "[.][benchmark]")
+{
+    std::vector<int32_t> items(256 * 1024 * 1024); // 1 GB
+    std::iota(items.begin(), items.end(), 0);
+    TempFile file{"accumulate_file_benchmark.bin", items};
+    items = std::vector<int32_t>{};
+
+    BENCHMARK("read into vector + accumulate")
+    {
+        const auto data = read_into_vector<int32_t>(file.path());
+        return Step5::accumulate(data.data(), data.data() + data.size());
+    };
+
+    BENCHMARK("accumulate_file")
+    {
+        return accumulate_file<int32_t>(file.path());
+    };
+}
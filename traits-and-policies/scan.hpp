@@ -0,0 +1,107 @@
+#ifndef TRAITS_AND_POLICIES_SCAN_HPP
+#define TRAITS_AND_POLICIES_SCAN_HPP
+
+#include "accumulate.hpp"
+#include "simd_scan.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// prefix scans - running accumulation of AccumulationPolicy widened to
+// Traits::AccumulatorType and written into a caller-provided output
+//
+inline namespace Step5
+{
+    namespace details
+    {
+        template <typename T, typename AccumulationPolicy, typename Traits>
+        typename Traits::AccumulatorType inclusive_scan_chunk(
+            T const* begin, T const* end, typename Traits::AccumulatorType* out, typename Traits::AccumulatorType carry)
+        {
+            using AccT = typename Traits::AccumulatorType;
+
+            if constexpr (std::is_same_v<AccumulationPolicy, SumPolicy> && SimdScan::HasKernel<T, AccT>)
+            {
+                return SimdScan::inclusive(begin, end, out, carry);
+            }
+            else
+            {
+                while (begin != end)
+                {
+                    AccumulationPolicy::accumulate(carry, *begin);
+                    *out = carry;
+                    ++begin;
+                    ++out;
+                }
+
+                return carry;
+            }
+        }
+    } // namespace details
+
+    // parallel version is a two-pass blocked scan: chunk totals are reduced first,
+    // then every chunk is scanned starting from the combined totals of the previous chunks
+    template <typename T, typename AccumulationPolicy = SumPolicy, typename Traits = AccumulationTraits<T>,
+        typename ExecutionPolicy = SequentialExecution>
+    typename Traits::AccumulatorType* inclusive_scan(T const* begin, T const* end, typename Traits::AccumulatorType* out)
+    {
+        using AccT = typename Traits::AccumulatorType;
+
+        const size_t size = static_cast<size_t>(end - begin);
+
+        if constexpr (ExecutionPolicy::is_parallel)
+        {
+            static_assert(CombinablePolicy<AccumulationPolicy, AccT>, "parallel scan requires AccumulationPolicy::combine()");
+
+            const size_t chunk_count = std::clamp<size_t>(size / min_parallel_chunk_size, 1, ExecutionPolicy::chunk_count());
+
+            if (chunk_count > 1)
+            {
+                auto chunk_begin = [=](size_t i) { return size * i / chunk_count; };
+
+                std::vector<AccT> carries(chunk_count, Traits::zero);
+
+                ExecutionPolicy::run(chunk_count - 1, [&](size_t i) {
+                    carries[i + 1] = accumulate<T, AccumulationPolicy, Traits>(begin + chunk_begin(i), begin + chunk_begin(i + 1));
+                });
+
+                // carries[i] = carries[i - 1] + carries[i] - combine() need not be commutative
+                for (size_t i = 1; i < chunk_count; ++i)
+                {
+                    AccT carry = carries[i - 1];
+                    AccumulationPolicy::combine(carry, carries[i]);
+                    carries[i] = carry;
+                }
+
+                ExecutionPolicy::run(chunk_count, [&](size_t i) {
+                    details::inclusive_scan_chunk<T, AccumulationPolicy, Traits>(
+                        begin + chunk_begin(i), begin + chunk_begin(i + 1), out + chunk_begin(i), carries[i]);
+                });
+
+                return out + size;
+            }
+        }
+
+        details::inclusive_scan_chunk<T, AccumulationPolicy, Traits>(begin, end, out, Traits::zero);
+
+        return out + size;
+    }
+
+    // out[i] - accumulation of items before i (out[0] == Traits::zero)
+    template <typename T, typename AccumulationPolicy = SumPolicy, typename Traits = AccumulationTraits<T>,
+        typename ExecutionPolicy = SequentialExecution>
+    typename Traits::AccumulatorType* exclusive_scan(T const* begin, T const* end, typename Traits::AccumulatorType* out)
+    {
+        if (begin == end)
+            return out;
+
+        *out = Traits::zero;
+
+        return inclusive_scan<T, AccumulationPolicy, Traits, ExecutionPolicy>(begin, end - 1, out + 1);
+    }
+} // namespace Step5
+
+#endif
@@ -0,0 +1,213 @@
+#include "scan.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/matchers/catch_matchers_floating_point.hpp>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace
+{
+    template <typename T>
+    std::vector<T> random_values(size_t size)
+    {
+        std::mt19937_64 rnd{665};
+        std::vector<T> data(size);
+
+        for (auto& item : data)
+        {
+            if constexpr (std::is_floating_point_v<T>)
+                item = static_cast<T>(std::uniform_real_distribution<double>(-100.0, 100.0)(rnd));
+            else
+                item = static_cast<T>(rnd());
+        }
+
+        return data;
+    }
+
+    template <typename T, typename TExecution = SequentialExecution>
+    void check_scans_match_std(size_t size)
+    {
+        using AccT = AccumulationTraits<T>::AccumulatorType;
+
+        const auto data = random_values<T>(size);
+        std::vector<AccT> result(size);
+        std::vector<AccT> expected(size);
+
+        auto result_end = Step5::inclusive_scan<T, SumPolicy, AccumulationTraits<T>, TExecution>(data.data(), data.data() + size, result.data());
+        std::inclusive_scan(data.begin(), data.end(), expected.begin(), std::plus<AccT>{}, AccT{});
+
+        REQUIRE(result_end == result.data() + size);
+        REQUIRE(result == expected);
+
+        result_end = Step5::exclusive_scan<T, SumPolicy, AccumulationTraits<T>, TExecution>(data.data(), data.data() + size, result.data());
+        std::exclusive_scan(data.begin(), data.end(), expected.begin(), AccT{});
+
+        REQUIRE(result_end == result.data() + size);
+        REQUIRE(result == expected);
+    }
+
+    // string concatenation as a polynomial hash - associative, but not commutative
+    struct ConcatHash
+    {
+        uint64_t hash;
+        uint64_t power;
+
+        bool operator==(const ConcatHash&) const = default;
+    };
+
+    struct ConcatAccumulationTraits
+    {
+        typedef ConcatHash AccumulatorType;
+        static constexpr AccumulatorType zero{0, 1};
+    };
+
+    struct ConcatPolicy
+    {
+        static constexpr uint64_t base = 131;
+
+        static void accumulate(ConcatHash& total, char value)
+        {
+            total.hash = total.hash * base + static_cast<unsigned char>(value);
+            total.power *= base;
+        }
+
+        static void combine(ConcatHash& total, const ConcatHash& partial)
+        {
+            total.hash = total.hash * partial.power + partial.hash;
+            total.power *= partial.power;
+        }
+    };
+} // namespace
+
+TEST_CASE("scan - integers with widening")
+{
+    const size_t size = GENERATE(0, 1, 15, 16, 17, 1'003);
+
+    SECTION("uint8_t")
+    {
+        check_scans_match_std<uint8_t>(size);
+    }
+
+    SECTION("int")
+    {
+        check_scans_match_std<int>(size);
+    }
+}
+
+TEST_CASE("scan - uint8_t does not overflow")
+{
+    std::vector<uint8_t> data(1'000, 255);
+    std::vector<unsigned int> result(data.size());
+
+    Step5::inclusive_scan(data.data(), data.data() + data.size(), result.data());
+
+    CHECK(result.back() == 255'000);
+}
+
+TEST_CASE("scan - float accumulated in double")
+{
+    const auto data = random_values<float>(1'003);
+    std::vector<double> result(data.size());
+    std::vector<double> expected(data.size());
+
+    Step5::inclusive_scan(data.data(), data.data() + data.size(), result.data());
+    std::inclusive_scan(data.begin(), data.end(), expected.begin(), std::plus<double>{}, 0.0);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        REQUIRE_THAT(result[i], Catch::Matchers::WithinAbs(expected[i], 1e-9));
+}
+
+TEST_CASE("scan - other policies use scalar path")
+{
+    const std::vector<int> data = {3, 1, 4, 1, 5, 9, 2, 6};
+    std::vector<int> result(data.size());
+
+    Step5::inclusive_scan<int, MaxPolicy, MaxAccumulationTraits<int>>(data.data(), data.data() + data.size(), result.data());
+
+    CHECK(result == std::vector{3, 3, 4, 4, 5, 9, 9, 9});
+}
+
+TEST_CASE("scan - two-pass parallel scan")
+{
+    const size_t size = 1'000'003;
+
+    SECTION("chunked parallel")
+    {
+        check_scans_match_std<uint8_t, ChunkedParallelExecution<4>>(size);
+        check_scans_match_std<int, ChunkedParallelExecution<3>>(size);
+    }
+
+    SECTION("thread pool")
+    {
+        check_scans_match_std<int, ThreadPoolExecution>(size);
+    }
+}
+
+TEST_CASE("scan - parallel scan keeps order of non-commutative combine")
+{
+    const auto data = random_values<char>(1'000'003);
+    std::vector<ConcatHash> expected(data.size());
+    std::vector<ConcatHash> result(data.size());
+
+    Step5::inclusive_scan<char, ConcatPolicy, ConcatAccumulationTraits>(data.data(), data.data() + data.size(), expected.data());
+
+    Step5::inclusive_scan<char, ConcatPolicy, ConcatAccumulationTraits, ChunkedParallelExecution<4>>(
+        data.data(), data.data() + data.size(), result.data());
+    CHECK(result == expected);
+
+    Step5::inclusive_scan<char, ConcatPolicy, ConcatAccumulationTraits, ThreadPoolExecution>(
+        data.data(), data.data() + data.size(), result.data());
+    CHECK(result == expected);
+}
+
+TEST_CASE("scan - throughput vs. std::inclusive_scan", "[.][benchmark]")
+{
+    const size_t size = 16 * 1024 * 1024;
+
+    const auto bytes = random_values<uint8_t>(size);
+    const auto ints = random_values<int>(size);
+    const auto floats = random_values<float>(size);
+    std::vector<unsigned int> bytes_out(size);
+    std::vector<long> ints_out(size);
+    std::vector<double> floats_out(size);
+
+    BENCHMARK("std::inclusive_scan - uint8_t")
+    {
+        return std::inclusive_scan(bytes.begin(), bytes.end(), bytes_out.begin(), std::plus<unsigned int>{}, 0u);
+    };
+
+    BENCHMARK("Step5::inclusive_scan - uint8_t")
+    {
+        return Step5::inclusive_scan(bytes.data(), bytes.data() + size, bytes_out.data());
+    };
+
+    BENCHMARK("std::inclusive_scan - int")
+    {
+        return std::inclusive_scan(ints.begin(), ints.end(), ints_out.begin(), std::plus<long>{}, 0L);
+    };
+
+    BENCHMARK("Step5::inclusive_scan - int")
+    {
+        return Step5::inclusive_scan(ints.data(), ints.data() + size, ints_out.data());
+    };
+
+    BENCHMARK("Step5::inclusive_scan - int - thread pool")
+    {
+        return Step5::inclusive_scan<int, SumPolicy, AccumulationTraits<int>, ThreadPoolExecution>(ints.data(), ints.data() + size, ints_out.data());
+    };
+
+    BENCHMARK("std::inclusive_scan - float")
+    {
+        return std::inclusive_scan(floats.begin(), floats.end(), floats_out.begin(), std::plus<double>{}, 0.0);
+    };
+
+    BENCHMARK("Step5::inclusive_scan - float")
+    {
+        return Step5::inclusive_scan(floats.data(), floats.data() + size, floats_out.data());
+    };
+}
@@ -0,0 +1,136 @@
+#ifndef TRAITS_AND_POLICIES_SERVICE_COLLECTION_HPP
+#define TRAITS_AND_POLICIES_SERVICE_COLLECTION_HPP
+
+#include "services.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace StaticPoly
+{
+    namespace details
+    {
+        template <typename T, typename... Ts>
+        constexpr size_t count_of = (size_t{std::is_same_v<T, Ts>} + ... + 0);
+
+        template <typename... Ts>
+        constexpr bool are_unique = ((count_of<Ts, Ts...> == 1) && ...);
+    } // namespace details
+
+    template <typename T, typename... Ts>
+    concept OneOf = (std::same_as<T, Ts> || ...);
+
+    /////////////////////////////////////////////////////////////////
+    // ServiceCollection - closed set of service types stored segment by segment
+    //
+    // Every type has its own contiguous vector, so for_each_run() walks
+    // the segments one after another with statically bound (inlinable) calls
+    // and no branch on the type of the item. Order of insertion is preserved
+    // only within a segment.
+    //
+    template <Service... Ts>
+    class ServiceCollection
+    {
+        static_assert(details::are_unique<Ts...>, "service types must be unique");
+
+        std::tuple<std::vector<Ts>...> segments_;
+
+    public:
+        template <OneOf<Ts...> TService, typename... TArgs>
+        TService& emplace(TArgs&&... args)
+        {
+            return segment<TService>().emplace_back(std::forward<TArgs>(args)...);
+        }
+
+        template <typename TService>
+            requires OneOf<std::remove_cvref_t<TService>, Ts...>
+        void push_back(TService&& srv)
+        {
+            segment<std::remove_cvref_t<TService>>().push_back(std::forward<TService>(srv));
+        }
+
+        template <OneOf<Ts...> TService>
+        std::vector<TService>& segment()
+        {
+            return std::get<std::vector<TService>>(segments_);
+        }
+
+        template <OneOf<Ts...> TService>
+        const std::vector<TService>& segment() const
+        {
+            return std::get<std::vector<TService>>(segments_);
+        }
+
+        size_t size() const
+        {
+            return (std::get<std::vector<Ts>>(segments_).size() + ... + 0);
+        }
+
+        void reserve(size_t size_per_type)
+        {
+            (std::get<std::vector<Ts>>(segments_).reserve(size_per_type), ...);
+        }
+
+        // calls f(srv.run()) for every service
+        template <typename F>
+        void for_each_run(F&& f)
+        {
+            auto run_segment = [&f](auto& services) {
+                for (auto& srv : services)
+                    f(srv.run());
+            };
+
+            (run_segment(std::get<std::vector<Ts>>(segments_)), ...);
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // VariantServiceCollection - closed set of service types in one vector
+    //
+    // Keeps the insertion order; every call is dispatched with std::visit
+    // (a jump on the index of the alternative, still without heap or vptr).
+    //
+    template <Service... Ts>
+    class VariantServiceCollection
+    {
+        std::vector<std::variant<Ts...>> services_;
+
+    public:
+        template <OneOf<Ts...> TService, typename... TArgs>
+        TService& emplace(TArgs&&... args)
+        {
+            return std::get<TService>(services_.emplace_back(std::in_place_type<TService>, std::forward<TArgs>(args)...));
+        }
+
+        template <typename TService>
+            requires OneOf<std::remove_cvref_t<TService>, Ts...>
+        void push_back(TService&& srv)
+        {
+            services_.emplace_back(std::forward<TService>(srv));
+        }
+
+        size_t size() const
+        {
+            return services_.size();
+        }
+
+        void reserve(size_t size)
+        {
+            services_.reserve(size);
+        }
+
+        template <typename F>
+        void for_each_run(F&& f)
+        {
+            for (auto& srv : services_)
+                f(std::visit([](auto& s) { return s.run(); }, srv));
+        }
+    };
+} // namespace StaticPoly
+
+#endif
@@ -0,0 +1,113 @@
+#include "service_collection.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+    struct NamedService
+    {
+        std::string name;
+
+        std::string run()
+        {
+            return name;
+        }
+    };
+} // namespace
+
+using namespace StaticPoly;
+
+TEST_CASE("ServiceCollection - segments by type")
+{
+    ServiceCollection<AService, AnotherService, NamedService> services;
+
+    services.push_back(AnotherService{});
+    services.emplace<NamedService>("first");
+    services.push_back(AService{});
+    services.emplace<NamedService>("second");
+    services.push_back(AnotherService{});
+
+    REQUIRE(services.size() == 5);
+    CHECK(services.segment<AService>().size() == 1);
+    CHECK(services.segment<AnotherService>().size() == 2);
+    CHECK(services.segment<NamedService>().size() == 2);
+
+    std::vector<std::string> results;
+    services.for_each_run([&](std::string result) { results.push_back(std::move(result)); });
+
+    CHECK(results == std::vector<std::string>{"AService runs...", "AnotherService runs...", "AnotherService runs...", "first", "second"});
+}
+
+TEST_CASE("VariantServiceCollection - insertion order")
+{
+    VariantServiceCollection<AService, AnotherService, NamedService> services;
+
+    services.push_back(AnotherService{});
+    CHECK(services.emplace<NamedService>("first").name == "first");
+    services.push_back(AService{});
+
+    REQUIRE(services.size() == 3);
+
+    std::vector<std::string> results;
+    services.for_each_run([&](std::string result) { results.push_back(std::move(result)); });
+
+    CHECK(results == std::vector<std::string>{"AnotherService runs...", "first", "AService runs..."});
+}
+
+TEST_CASE("ServiceCollection vs. vector<unique_ptr<Service>>", "[.][benchmark]")
+{
+    const size_t size = 1'000'000;
+
+    std::vector<std::unique_ptr<DynamicPoly::Service>> dynamic_services;
+    ServiceCollection<AService, AnotherService> collection;
+    VariantServiceCollection<AService, AnotherService> variant_collection;
+
+    std::mt19937 rnd{42};
+
+    dynamic_services.reserve(size);
+    collection.reserve(size / 2);
+    variant_collection.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (rnd() % 2 == 0) // types are shuffled, as in a collection built at runtime
+        {
+            dynamic_services.push_back(std::make_unique<DynamicPoly::AService>());
+            collection.push_back(AService{});
+            variant_collection.push_back(AService{});
+        }
+        else
+        {
+            dynamic_services.push_back(std::make_unique<DynamicPoly::AnotherService>());
+            collection.push_back(AnotherService{});
+            variant_collection.push_back(AnotherService{});
+        }
+    }
+
+    BENCHMARK("vector<unique_ptr<DynamicPoly::Service>>")
+    {
+        size_t length = 0;
+        for (auto& srv : dynamic_services)
+            length += srv->run().size();
+        return length;
+    };
+
+    BENCHMARK("ServiceCollection")
+    {
+        size_t length = 0;
+        collection.for_each_run([&](const std::string& result) { length += result.size(); });
+        return length;
+    };
+
+    BENCHMARK("VariantServiceCollection")
+    {
+        size_t length = 0;
+        variant_collection.for_each_run([&](const std::string& result) { length += result.size(); });
+        return length;
+    };
+}
@@ -0,0 +1,183 @@
+#ifndef TRAITS_AND_POLICIES_SERVICES_HPP
+#define TRAITS_AND_POLICIES_SERVICES_HPP
+
+#include <concepts>
+#include <iostream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+////////////////////////////////////////////////////////////////////////////////
+// dynamic polymorphism
+
+namespace DynamicPoly
+{
+
+    class Service
+    {
+    public:
+        virtual ~Service() = default;
+        virtual std::string run() = 0;
+
+        // appends the output to a caller-owned buffer - the default adapts run()
+        virtual void run_into(std::string& sink)
+        {
+            sink += run();
+        }
+    };
+
+    class AService : public Service
+    {
+    public:
+        std::string run() override
+        {
+            return "AService runs...";
+        }
+
+        void run_into(std::string& sink) override
+        {
+            sink += "AService runs...";
+        }
+    };
+
+    class AnotherService : public Service
+    {
+    public:
+        std::string run() override
+        {
+            return "AnotherService runs...";
+        }
+
+        void run_into(std::string& sink) override
+        {
+            sink += "AnotherService runs...";
+        }
+    };
+
+    class User
+    {
+        std::unique_ptr<Service> srv_;
+        std::string buffer_;
+
+    public:
+        User(std::unique_ptr<Service> srv)
+            : srv_(std::move(srv))
+        { }
+
+        // output is rendered into a reused buffer and written at once
+        void use(std::ostream& out = std::cout)
+        {
+            buffer_.clear();
+            srv_->run_into(buffer_);
+            buffer_ += '\n';
+            out.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        }
+    };
+} // namespace DynamicPoly
+
+namespace StaticPoly
+{
+    template<typename T>
+    concept Service = requires(T srv) {
+        { srv.run() } -> std::same_as<std::string>;
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // output-sink services - run(sink) appends to a caller-owned buffer,
+    // so a reused buffer makes the call allocation-free
+    //
+    template <typename T>
+    concept OutputSink = requires(T sink, std::string_view text) {
+        sink.append(text);
+    };
+
+    class AService
+    {
+    public:
+        std::string run()
+        {
+            return "AService runs...";
+        }
+
+        template <OutputSink TSink>
+        void run(TSink& sink)
+        {
+            sink.append(std::string_view{"AService runs..."});
+        }
+    };
+
+    class AnotherService
+    {
+    public:
+        std::string run()
+        {
+            return "AnotherService runs...";
+        }
+
+        template <OutputSink TSink>
+        void run(TSink& sink)
+        {
+            sink.append(std::string_view{"AnotherService runs..."});
+        }
+    };
+
+    static_assert(Service<AnotherService>);
+
+    template <typename T, typename TSink = std::string>
+    concept SinkService = OutputSink<TSink> && requires(T srv, TSink& sink) {
+        srv.run(sink);
+    };
+
+    template <typename T>
+    concept AnyOutputService = Service<T> || SinkService<T>;
+
+    // services with only std::string run() are adapted automatically
+    template <AnyOutputService TService, OutputSink TSink>
+    void run_into(TService& srv, TSink& sink)
+    {
+        if constexpr (SinkService<TService, TSink>)
+            srv.run(sink);
+        else
+            sink.append(std::string_view{srv.run()});
+    }
+
+    template <AnyOutputService TService>
+    class User
+    {
+        TService srv_;
+        std::string buffer_;
+
+    public:
+        User(TService srv)
+            : srv_(std::move(srv))
+        { }
+
+        // output is rendered into a reused buffer and written at once
+        void use(std::ostream& out = std::cout)
+        {
+            buffer_.clear();
+            render(buffer_);
+            out.write(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        }
+
+        template <OutputSink TSink>
+        void render(TSink& sink)
+        {
+            run_into(srv_, sink);
+            sink.append(std::string_view{"\n"});
+        }
+    };
+
+    // output of all users is batched into one write
+    template <typename TUsers>
+    void use_all(TUsers& users, std::string& buffer, std::ostream& out = std::cout)
+    {
+        buffer.clear();
+        for (auto& user : users)
+            user.render(buffer);
+        out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    }
+} // namespace StaticPoly
+
+#endif
@@ -0,0 +1,172 @@
+#include "allocation_counter.hpp"
+#include "services.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <vector>
+
+namespace
+{
+    // discards everything written into it
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override
+        {
+            return c;
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            return count;
+        }
+    };
+
+    struct LegacyService
+    {
+        std::string run()
+        {
+            return "LegacyService runs...";
+        }
+    };
+
+    struct SinkOnlyService
+    {
+        void run(std::string& sink)
+        {
+            sink += "SinkOnlyService runs...";
+        }
+    };
+} // namespace
+
+TEST_CASE("sink services - output")
+{
+    std::ostringstream out;
+
+    SECTION("static polymorphism")
+    {
+        StaticPoly::User user1{StaticPoly::AService{}};
+        StaticPoly::User user2{LegacyService{}}; // adapted
+        StaticPoly::User user3{SinkOnlyService{}};
+
+        user1.use(out);
+        user2.use(out);
+        user3.use(out);
+
+        CHECK(out.str() == "AService runs...\nLegacyService runs...\nSinkOnlyService runs...\n");
+    }
+
+    SECTION("dynamic polymorphism")
+    {
+        DynamicPoly::User user{std::make_unique<DynamicPoly::AnotherService>()};
+        user.use(out);
+
+        CHECK(out.str() == "AnotherService runs...\n");
+    }
+
+    SECTION("batched users")
+    {
+        std::vector<StaticPoly::User<StaticPoly::AnotherService>> users(3, StaticPoly::User{StaticPoly::AnotherService{}});
+        std::string buffer;
+        StaticPoly::use_all(users, buffer, out);
+
+        CHECK(out.str() == "AnotherService runs...\nAnotherService runs...\nAnotherService runs...\n");
+    }
+}
+
+TEST_CASE("sink services - no allocations with reused buffer")
+{
+    NullBuffer null_buffer;
+    std::ostream out{&null_buffer};
+
+    SECTION("StaticPoly::User")
+    {
+        StaticPoly::User user{StaticPoly::AnotherService{}};
+        user.use(out); // buffer grows once
+
+        CHECK(count_allocations([&] {
+            for (int i = 0; i < 100; ++i)
+                user.use(out);
+        }) == 0);
+    }
+
+    SECTION("DynamicPoly::User")
+    {
+        DynamicPoly::User user{std::make_unique<DynamicPoly::AService>()};
+        user.use(out);
+
+        CHECK(count_allocations([&] {
+            for (int i = 0; i < 100; ++i)
+                user.use(out);
+        }) == 0);
+    }
+
+    SECTION("std::string run() allocates on every call")
+    {
+        StaticPoly::AnotherService srv;
+        std::string sink;
+        sink.reserve(64);
+
+        CHECK(count_allocations([&] {
+            for (int i = 0; i < 100; ++i)
+                out << srv.run() << "\n";
+        }) == 100);
+
+        CHECK(count_allocations([&] {
+            for (int i = 0; i < 100; ++i)
+            {
+                sink.clear();
+                StaticPoly::run_into(srv, sink);
+            }
+        }) == 0);
+    }
+}
+
+TEST_CASE("sink services - latency of use()", "[.][benchmark]")
+{
+    NullBuffer null_buffer;
+    std::ostream out{&null_buffer};
+
+    StaticPoly::AnotherService srv;
+    StaticPoly::User static_user{StaticPoly::AnotherService{}};
+    DynamicPoly::User dynamic_user{std::make_unique<DynamicPoly::AnotherService>()};
+    DynamicPoly::AnotherService dynamic_srv;
+    DynamicPoly::Service& dynamic_ref = dynamic_srv;
+
+    BENCHMARK("out << run() << \"\\n\" - static")
+    {
+        out << srv.run() << "\n";
+    };
+
+    BENCHMARK("out << run() << \"\\n\" - dynamic")
+    {
+        out << dynamic_ref.run() << "\n";
+    };
+
+    BENCHMARK("StaticPoly::User::use()")
+    {
+        static_user.use(out);
+    };
+
+    BENCHMARK("DynamicPoly::User::use()")
+    {
+        dynamic_user.use(out);
+    };
+
+    std::vector<StaticPoly::User<StaticPoly::AnotherService>> users(1'000, StaticPoly::User{StaticPoly::AnotherService{}});
+    std::string buffer;
+
+    BENCHMARK("1000 x User::use()")
+    {
+        for (auto& user : users)
+            user.use(out);
+    };
+
+    BENCHMARK("use_all() - 1000 users")
+    {
+        StaticPoly::use_all(users, buffer, out);
+    };
+}
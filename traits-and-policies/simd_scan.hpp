@@ -0,0 +1,150 @@
+#ifndef TRAITS_AND_POLICIES_SIMD_SCAN_HPP
+#define TRAITS_AND_POLICIES_SIMD_SCAN_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#endif
+
+/////////////////////////////////////////////////////////////////
+// In-register prefix sum kernels used by inclusive_scan/exclusive_scan with SumPolicy
+//
+// Elements are widened to the accumulator type, each register is scanned with
+// log2(lanes) shift & add steps and the carry (the last lane) is broadcast to
+// the next register. Every kernel returns the last inclusive value.
+//
+namespace SimdScan
+{
+    template <typename T, typename TAccumulator>
+    concept HasKernel = (std::same_as<T, uint8_t> && std::integral<TAccumulator> && sizeof(TAccumulator) == 4)
+        || (std::same_as<T, int> && std::integral<TAccumulator> && sizeof(TAccumulator) == 8)
+        || (std::same_as<T, float> && std::same_as<TAccumulator, double>);
+
+#if defined(__SSE2__) || defined(_M_X64)
+    namespace details
+    {
+        inline __m128i scan_epi32(__m128i v, __m128i carry)
+        {
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 4));
+            v = _mm_add_epi32(v, _mm_slli_si128(v, 8));
+            return _mm_add_epi32(v, carry);
+        }
+
+        inline __m128i scan_epi64(__m128i v, __m128i carry)
+        {
+            v = _mm_add_epi64(v, _mm_slli_si128(v, 8));
+            return _mm_add_epi64(v, carry);
+        }
+
+        inline __m128d scan_pd(__m128d v, __m128d carry)
+        {
+            v = _mm_add_pd(v, _mm_castsi128_pd(_mm_slli_si128(_mm_castpd_si128(v), 8)));
+            return _mm_add_pd(v, carry);
+        }
+    } // namespace details
+#endif
+
+    template <typename TAccumulator>
+    TAccumulator inclusive(const uint8_t* begin, const uint8_t* end, TAccumulator* out, TAccumulator carry)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i carry_vec = _mm_set1_epi32(static_cast<int>(carry));
+
+        for (; i + 16 <= size; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+            const __m128i lo = _mm_unpacklo_epi8(v, zero);
+            const __m128i hi = _mm_unpackhi_epi8(v, zero);
+            const __m128i quarters[4] = {_mm_unpacklo_epi16(lo, zero), _mm_unpackhi_epi16(lo, zero),
+                _mm_unpacklo_epi16(hi, zero), _mm_unpackhi_epi16(hi, zero)};
+
+            for (int k = 0; k < 4; ++k)
+            {
+                const __m128i scanned = details::scan_epi32(quarters[k], carry_vec);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4 * k), scanned);
+                carry_vec = _mm_shuffle_epi32(scanned, 0xFF);
+            }
+        }
+
+        carry = static_cast<TAccumulator>(_mm_cvtsi128_si32(carry_vec));
+#endif
+
+        for (; i < size; ++i)
+            out[i] = carry = static_cast<TAccumulator>(carry + begin[i]);
+
+        return carry;
+    }
+
+    template <typename TAccumulator>
+    TAccumulator inclusive(const int* begin, const int* end, TAccumulator* out, TAccumulator carry)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        __m128i carry_vec = _mm_set1_epi64x(static_cast<int64_t>(carry));
+
+        for (; i + 4 <= size; i += 4)
+        {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i));
+            const __m128i sign = _mm_srai_epi32(v, 31);
+            const __m128i halves[2] = {_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)};
+
+            for (int k = 0; k < 2; ++k)
+            {
+                const __m128i scanned = details::scan_epi64(halves[k], carry_vec);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 2 * k), scanned);
+                carry_vec = _mm_shuffle_epi32(scanned, 0xEE);
+            }
+        }
+
+        carry = static_cast<TAccumulator>(_mm_cvtsi128_si64(carry_vec));
+#endif
+
+        for (; i < size; ++i)
+            out[i] = carry = static_cast<TAccumulator>(carry + begin[i]);
+
+        return carry;
+    }
+
+    inline double inclusive(const float* begin, const float* end, double* out, double carry)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+
+#if defined(__SSE2__) || defined(_M_X64)
+        __m128d carry_vec = _mm_set1_pd(carry);
+
+        for (; i + 4 <= size; i += 4)
+        {
+            const __m128 v = _mm_loadu_ps(begin + i);
+            const __m128d halves[2] = {_mm_cvtps_pd(v), _mm_cvtps_pd(_mm_movehl_ps(v, v))};
+
+            for (int k = 0; k < 2; ++k)
+            {
+                const __m128d scanned = details::scan_pd(halves[k], carry_vec);
+                _mm_storeu_pd(out + i + 2 * k, scanned);
+                carry_vec = _mm_unpackhi_pd(scanned, scanned);
+            }
+        }
+
+        carry = _mm_cvtsd_f64(carry_vec);
+#endif
+
+        // bounded by end - with an index bound GCC assumes out + i may overflow (-Waggressive-loop-optimizations)
+        out += i;
+        for (const float* it = begin + i; it != end; ++it)
+            *out++ = carry = carry + *it;
+
+        return carry;
+    }
+} // namespace SimdScan
+
+#endif
@@ -0,0 +1,221 @@
+#ifndef TRAITS_AND_POLICIES_SIMD_SUM_HPP
+#define TRAITS_AND_POLICIES_SIMD_SUM_HPP
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <immintrin.h>
+#define TRAITS_AND_POLICIES_HAS_SSE2
+#endif
+
+/////////////////////////////////////////////////////////////////
+// Vectorized sum kernels used by Step5::accumulate with SumPolicy
+//
+// Every kernel keeps four independent accumulators, so consecutive additions
+// do not wait for each other. Integer kernels sum in 64-bit lanes and give
+// exactly the same result as the scalar loop; floating point kernels reorder
+// additions and may differ in the last bits.
+//
+namespace SimdSum
+{
+    template <typename T, typename TAccumulator>
+    concept HasKernel = (std::same_as<T, uint8_t> && std::integral<TAccumulator> && !std::same_as<TAccumulator, bool>)
+        || (std::same_as<T, int> && std::integral<TAccumulator> && sizeof(TAccumulator) == sizeof(int64_t))
+        || ((std::same_as<T, float> || std::same_as<T, double>) && std::same_as<TAccumulator, double>);
+
+    // uint8_t - psadbw sums 8 bytes into one 64-bit lane
+    inline uint64_t sum(const uint8_t* begin, const uint8_t* end)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+        uint64_t total = 0;
+
+#if defined(__AVX2__)
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i acc[4] = {zero, zero, zero, zero};
+
+        for (; i + 128 <= size; i += 128)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin + i + 32 * k));
+                acc[k] = _mm256_add_epi64(acc[k], _mm256_sad_epu8(v, zero));
+            }
+        }
+
+        const __m256i acc_all = _mm256_add_epi64(_mm256_add_epi64(acc[0], acc[1]), _mm256_add_epi64(acc[2], acc[3]));
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc_all);
+        total += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(TRAITS_AND_POLICIES_HAS_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        __m128i acc[4] = {zero, zero, zero, zero};
+
+        for (; i + 64 <= size; i += 64)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i + 16 * k));
+                acc[k] = _mm_add_epi64(acc[k], _mm_sad_epu8(v, zero));
+            }
+        }
+
+        const __m128i acc_all = _mm_add_epi64(_mm_add_epi64(acc[0], acc[1]), _mm_add_epi64(acc[2], acc[3]));
+        alignas(16) uint64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc_all);
+        total += lanes[0] + lanes[1];
+#endif
+
+        uint64_t partial[4] = {};
+        for (; i + 4 <= size; i += 4)
+            for (size_t k = 0; k < 4; ++k)
+                partial[k] += begin[i + k];
+
+        for (; i < size; ++i)
+            partial[0] += begin[i];
+
+        return total + partial[0] + partial[1] + partial[2] + partial[3];
+    }
+
+    // int - lanes are sign-extended to 64 bits before addition
+    inline int64_t sum(const int* begin, const int* end)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+        int64_t total = 0;
+
+#if defined(__AVX2__)
+        __m256i acc[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+
+        for (; i + 16 <= size; i += 16)
+        {
+            for (int k = 0; k < 4; ++k)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i + 4 * k));
+                acc[k] = _mm256_add_epi64(acc[k], _mm256_cvtepi32_epi64(v));
+            }
+        }
+
+        const __m256i acc_all = _mm256_add_epi64(_mm256_add_epi64(acc[0], acc[1]), _mm256_add_epi64(acc[2], acc[3]));
+        alignas(32) int64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc_all);
+        total += lanes[0] + lanes[1] + lanes[2] + lanes[3];
+#elif defined(TRAITS_AND_POLICIES_HAS_SSE2)
+        __m128i acc[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+
+        for (; i + 8 <= size; i += 8)
+        {
+            for (int k = 0; k < 2; ++k)
+            {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin + i + 4 * k));
+                const __m128i sign = _mm_srai_epi32(v, 31);
+                acc[2 * k] = _mm_add_epi64(acc[2 * k], _mm_unpacklo_epi32(v, sign));
+                acc[2 * k + 1] = _mm_add_epi64(acc[2 * k + 1], _mm_unpackhi_epi32(v, sign));
+            }
+        }
+
+        const __m128i acc_all = _mm_add_epi64(_mm_add_epi64(acc[0], acc[1]), _mm_add_epi64(acc[2], acc[3]));
+        alignas(16) int64_t lanes[2];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), acc_all);
+        total += lanes[0] + lanes[1];
+#endif
+
+        int64_t partial[4] = {};
+        for (; i + 4 <= size; i += 4)
+            for (size_t k = 0; k < 4; ++k)
+                partial[k] += begin[i + k];
+
+        for (; i < size; ++i)
+            partial[0] += begin[i];
+
+        return total + partial[0] + partial[1] + partial[2] + partial[3];
+    }
+
+    inline double sum(const float* begin, const float* end)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+        double total = 0.0;
+
+#if defined(__AVX__)
+        __m256d acc[4] = {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+
+        for (; i + 16 <= size; i += 16)
+            for (int k = 0; k < 4; ++k)
+                acc[k] = _mm256_add_pd(acc[k], _mm256_cvtps_pd(_mm_loadu_ps(begin + i + 4 * k)));
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(acc[0], acc[1]), _mm256_add_pd(acc[2], acc[3])));
+        total += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(TRAITS_AND_POLICIES_HAS_SSE2)
+        __m128d acc[4] = {_mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd()};
+
+        for (; i + 8 <= size; i += 8)
+        {
+            for (int k = 0; k < 2; ++k)
+            {
+                const __m128 v = _mm_loadu_ps(begin + i + 4 * k);
+                acc[2 * k] = _mm_add_pd(acc[2 * k], _mm_cvtps_pd(v));
+                acc[2 * k + 1] = _mm_add_pd(acc[2 * k + 1], _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+            }
+        }
+
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, _mm_add_pd(_mm_add_pd(acc[0], acc[1]), _mm_add_pd(acc[2], acc[3])));
+        total += lanes[0] + lanes[1];
+#endif
+
+        double partial[4] = {};
+        for (; i + 4 <= size; i += 4)
+            for (size_t k = 0; k < 4; ++k)
+                partial[k] += begin[i + k];
+
+        for (; i < size; ++i)
+            partial[0] += begin[i];
+
+        return total + ((partial[0] + partial[1]) + (partial[2] + partial[3]));
+    }
+
+    inline double sum(const double* begin, const double* end)
+    {
+        const size_t size = static_cast<size_t>(end - begin);
+        size_t i = 0;
+        double total = 0.0;
+
+#if defined(__AVX__)
+        __m256d acc[4] = {_mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd(), _mm256_setzero_pd()};
+
+        for (; i + 16 <= size; i += 16)
+            for (int k = 0; k < 4; ++k)
+                acc[k] = _mm256_add_pd(acc[k], _mm256_loadu_pd(begin + i + 4 * k));
+
+        alignas(32) double lanes[4];
+        _mm256_store_pd(lanes, _mm256_add_pd(_mm256_add_pd(acc[0], acc[1]), _mm256_add_pd(acc[2], acc[3])));
+        total += (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(TRAITS_AND_POLICIES_HAS_SSE2)
+        __m128d acc[4] = {_mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd(), _mm_setzero_pd()};
+
+        for (; i + 8 <= size; i += 8)
+            for (int k = 0; k < 4; ++k)
+                acc[k] = _mm_add_pd(acc[k], _mm_loadu_pd(begin + i + 2 * k));
+
+        alignas(16) double lanes[2];
+        _mm_store_pd(lanes, _mm_add_pd(_mm_add_pd(acc[0], acc[1]), _mm_add_pd(acc[2], acc[3])));
+        total += lanes[0] + lanes[1];
+#endif
+
+        double partial[4] = {};
+        for (; i + 4 <= size; i += 4)
+            for (size_t k = 0; k < 4; ++k)
+                partial[k] += begin[i + k];
+
+        for (; i < size; ++i)
+            partial[0] += begin[i];
+
+        return total + ((partial[0] + partial[1]) + (partial[2] + partial[3]));
+    }
+} // namespace SimdSum
+
+#endif
@@ -0,0 +1,117 @@
+#ifndef TRAITS_AND_POLICIES_THREAD_POOL_HPP
+#define TRAITS_AND_POLICIES_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////
+// ThreadPool - fixed number of workers sharing one FIFO queue of tasks
+//
+class ThreadPool
+{
+public:
+    explicit ThreadPool(size_t size = default_size())
+    {
+        threads_.reserve(size);
+        for (size_t i = 0; i < size; ++i)
+            threads_.emplace_back([this] { run(); });
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool()
+    {
+        {
+            std::lock_guard lk{mtx_};
+            stopped_ = true;
+        }
+        cv_.notify_all();
+        // jthreads are joined after the remaining tasks are done
+    }
+
+    size_t size() const
+    {
+        return threads_.size();
+    }
+
+    template <typename F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& f)
+    {
+        using TResult = std::invoke_result_t<std::decay_t<F>>;
+
+        // std::function requires copyable target - packaged_task is move-only
+        auto task = std::make_shared<std::packaged_task<TResult()>>(std::forward<F>(f));
+        auto result = task->get_future();
+
+        {
+            std::lock_guard lk{mtx_};
+            tasks_.push([task] { (*task)(); });
+        }
+        cv_.notify_one();
+
+        return result;
+    }
+
+    // pool shared by the whole process - created on first use
+    static ThreadPool& instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    // true when called from a task running on one of the workers of this pool
+    bool is_worker_thread() const
+    {
+        return current_pool_ == this;
+    }
+
+    static size_t default_size()
+    {
+        return std::max(1u, std::thread::hardware_concurrency());
+    }
+
+private:
+    std::mutex mtx_;
+    std::condition_variable cv_;
+    std::queue<std::function<void()>> tasks_;
+    bool stopped_ = false;
+    std::vector<std::jthread> threads_; // the last member - threads are joined before the queue is destroyed
+
+    inline static thread_local const ThreadPool* current_pool_ = nullptr;
+
+    void run()
+    {
+        current_pool_ = this;
+
+        while (true)
+        {
+            std::function<void()> task;
+
+            {
+                std::unique_lock lk{mtx_};
+                cv_.wait(lk, [this] { return stopped_ || !tasks_.empty(); });
+
+                if (tasks_.empty())
+                    return;
+
+                task = std::move(tasks_.front());
+                tasks_.pop();
+            }
+
+            task();
+        }
+    }
+};
+
+#endif
@@ -1,3 +1,6 @@
+#include "accumulate.hpp"
+#include "services.hpp"
+
 #include <algorithm>
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
@@ -185,66 +188,6 @@ TEST_CASE("accumulate - 4")
     CHECK(result == 32640); // should be 1 + 2 + 3 + ... + 255 = 32640 (uint8_t overflow)
 }
 
-inline namespace Step5
-{
-    template <typename T>
-    struct AccumulationTraits;
-
-    template <>
-    struct AccumulationTraits<uint8_t>
-    {
-        typedef unsigned int AccumulatorType;
-        static constexpr AccumulatorType const zero = 0;
-    };
-
-    template <>
-    struct AccumulationTraits<int>
-    {
-        typedef long AccumulatorType;
-        static constexpr AccumulatorType zero = 0;
-    };
-
-    struct SumPolicy
-    {
-        template <typename T1, typename T2>
-        static void accumulate(T1& total, const T2& value)
-        {
-            total += value;
-        }
-    };
-
-    template <typename T, typename AccumulationPolicy = SumPolicy, typename Traits = AccumulationTraits<T>>
-    typename Traits::AccumulatorType accumulate(T const* begin, T const* end)
-    {
-        using AccT = typename Traits::AccumulatorType;
-
-        AccT total = Traits::zero;
-
-        while (begin != end)
-        {
-            AccumulationPolicy::accumulate(total, *begin);
-            ++begin;
-        }
-
-        return total;
-    }
-} // namespace Step5
-
-struct MultiplyAccumulationTraits
-{
-    typedef unsigned int AccumulatorType;
-    static constexpr AccumulatorType const zero = 1;
-};
-
-struct MultiplyPolicy
-{
-    template <typename T1, typename T2>
-    static void accumulate(T1& total, const T2& value)
-    {
-        total *= value;
-    }
-};
-
 TEST_CASE("accumulate - 5")
 {
     using namespace std;
@@ -258,97 +201,6 @@ TEST_CASE("accumulate - 5")
     cout << "result: " << static_cast<int>(result) << endl;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-// dynamic polymorphism
-
-namespace DynamicPoly
-{
-
-    class Service
-    {
-    public:
-        virtual ~Service() = default;
-        virtual std::string run() = 0;
-    };
-
-    class AService : public Service
-    {
-    public:
-        std::string run() override
-        {
-            return "AService runs...";
-        }
-    };
-
-    class AnotherService : public Service
-    {
-    public:
-        std::string run() override
-        {
-            return "AnotherService runs...";
-        }
-    };
-
-    class User
-    {
-        std::unique_ptr<Service> srv_;
-
-    public:
-        User(std::unique_ptr<Service> srv)
-            : srv_(std::move(srv))
-        { }
-
-        void use()
-        {
-            std::cout << srv_->run() << "\n";
-        }
-    };
-} // namespace DynamicPoly
-
-namespace StaticPoly
-{
-    template<typename T>
-    concept Service = requires(T srv) {
-        { srv.run() } -> std::same_as<std::string>;
-    };
-
-    class AService
-    {
-    public:
-        std::string run()
-        {
-            return "AService runs...";
-        }
-    };
-
-    class AnotherService
-    {
-    public:
-        std::string run()
-        {
-            return "AnotherService runs...";
-        }
-    };
-
-    static_assert(Service<AnotherService>);
-
-    template <Service TService>
-    class User
-    {
-        TService srv_;
-
-    public:
-        User(TService srv)
-            : srv_(std::move(srv))
-        { }
-
-        void use()
-        {
-            std::cout << srv_.run() << "\n";
-        }
-    };
-} // namespace DynamicPoly
-
 TEST_CASE("dynamic poly")
 {
     DynamicPoly::User user1(std::make_unique<DynamicPoly::AnotherService>());
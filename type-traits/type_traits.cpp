@@ -1,3 +1,5 @@
+#include "type_traits.hpp"
+
 #include <catch2/catch_test_macros.hpp>
 #include <iostream>
 #include <string>
@@ -5,15 +7,6 @@
 
 using namespace std::literals;
 
-template <typename T>
-struct Identity
-{
-    using type = T;
-};
-
-template <typename T>
-using Identity_t = typename Identity<T>::type;
-
 TEST_CASE("type traits - Identity")
 {
     static_assert(std::is_same_v<Identity<int>::type, int>);
@@ -81,27 +74,12 @@ TEST_CASE("type traits - RemoveRef")
 
 //////////////////////////////////////////////////////////////////
 
-template <typename T, T v>
-struct IntegralConstant 
-{
-    static constexpr T value = v;
-};
-
-template <typename T, T v>
-constexpr T IntegralConstant_v = IntegralConstant<T, v>::value;
-
 TEST_CASE("type traits - IntegralConstant")
 {
     static_assert(IntegralConstant<int, 5>::value == 5);
     static_assert(IntegralConstant_v<int, 5> == 5);
 }
 
-template <bool v>
-using BoolConstant = IntegralConstant<bool, v>;
-
-using TrueType = BoolConstant<true>;
-using FalseType = BoolConstant<false>;
-
 ////////////////////////////////////////////////////////////////////
 
 template <typename T>
@@ -0,0 +1,28 @@
+#ifndef TYPE_TRAITS_TYPE_TRAITS_HPP
+#define TYPE_TRAITS_TYPE_TRAITS_HPP
+
+template <typename T>
+struct Identity
+{
+    using type = T;
+};
+
+template <typename T>
+using Identity_t = typename Identity<T>::type;
+
+template <typename T, T v>
+struct IntegralConstant
+{
+    static constexpr T value = v;
+};
+
+template <typename T, T v>
+constexpr T IntegralConstant_v = IntegralConstant<T, v>::value;
+
+template <bool v>
+using BoolConstant = IntegralConstant<bool, v>;
+
+using TrueType = BoolConstant<true>;
+using FalseType = BoolConstant<false>;
+
+#endif
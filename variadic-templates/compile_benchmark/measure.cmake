@@ -0,0 +1,58 @@
+# Compiles SOURCE once per size from SIZES (-DTYPE_LIST_SIZE=N) and records
+# build time and peak memory of the compiler in OUTPUT
+#
+# cmake -DCOMPILER=... -DFLAGS=... -DSOURCE=... -DSIZES=100,1000,5000 -DOUTPUT=... [-DTIME_COMMAND=...] -P measure.cmake
+
+separate_arguments(FLAGS UNIX_COMMAND "${FLAGS}")
+string(REPLACE "," ";" SIZES "${SIZES}")
+
+set(REPORT "size,seconds,peak_memory_kb\n")
+
+# timestamps in microseconds - %f needs CMake 3.23, older versions measure whole seconds
+if(CMAKE_VERSION VERSION_GREATER_EQUAL 3.23)
+    set(TIMESTAMP_FORMAT "%s%f")
+else()
+    set(TIMESTAMP_FORMAT "%s000000")
+endif()
+
+foreach(SIZE IN LISTS SIZES)
+    get_filename_component(OUTPUT_DIR ${OUTPUT} DIRECTORY)
+    set(OBJECT ${OUTPUT_DIR}/type_list_benchmark_${SIZE}.o)
+    set(COMPILE_COMMAND ${COMPILER} ${FLAGS} -DTYPE_LIST_SIZE=${SIZE} -c ${SOURCE} -o ${OBJECT})
+
+    string(TIMESTAMP START "${TIMESTAMP_FORMAT}")
+    if(TIME_COMMAND)
+        # GNU time - %M is the maximum resident set size in KB
+        execute_process(COMMAND ${TIME_COMMAND} -f "%M" ${COMPILE_COMMAND}
+                        RESULT_VARIABLE RESULT
+                        ERROR_VARIABLE ERRORS)
+    else()
+        execute_process(COMMAND ${COMPILE_COMMAND}
+                        RESULT_VARIABLE RESULT
+                        ERROR_VARIABLE ERRORS)
+    endif()
+    string(TIMESTAMP STOP "${TIMESTAMP_FORMAT}")
+
+    if(NOT RESULT EQUAL 0)
+        message(FATAL_ERROR "TypeList benchmark for ${SIZE} types failed:\n${ERRORS}")
+    endif()
+
+    math(EXPR MILLISECONDS "(${STOP} - ${START}) / 1000")
+    math(EXPR SECONDS "${MILLISECONDS} / 1000")
+    math(EXPR FRACTION "${MILLISECONDS} % 1000 + 1000")
+    string(SUBSTRING ${FRACTION} 1 3 FRACTION)
+
+    set(PEAK_MEMORY "n/a")
+    set(PEAK_MEMORY_STATUS "n/a (GNU time not found)")
+    if(TIME_COMMAND)
+        string(REGEX MATCH "[0-9]+[ \t\r\n]*$" PEAK_MEMORY "${ERRORS}")
+        string(STRIP "${PEAK_MEMORY}" PEAK_MEMORY)
+        set(PEAK_MEMORY_STATUS "${PEAK_MEMORY} KB")
+    endif()
+
+    message(STATUS "TypeList<${SIZE} types>: ${SECONDS}.${FRACTION} s, peak memory: ${PEAK_MEMORY_STATUS}")
+    string(APPEND REPORT "${SIZE},${SECONDS}.${FRACTION},${PEAK_MEMORY}\n")
+endforeach()
+
+file(WRITE ${OUTPUT} "${REPORT}")
+message(STATUS "Results saved to ${OUTPUT}")
@@ -0,0 +1,48 @@
+// compiled by the compile-benchmark-type-list target (see ../CMakeLists.txt) with -DTYPE_LIST_SIZE=N
+#include "type_list.hpp"
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+#ifndef TYPE_LIST_SIZE
+#define TYPE_LIST_SIZE 100
+#endif
+
+namespace
+{
+    constexpr size_t size = TYPE_LIST_SIZE;
+    constexpr size_t unique_count = (size + 1) / 2; // for an odd size the last value occurs once
+
+    static_assert(size > 0 && size % 7919 != 0, "TYPE_LIST_SIZE must be positive and coprime with 7919");
+
+    template <size_t N>
+    using Number = IntegralConstant<size_t, N>;
+
+    template <typename T>
+    using Key = IntegralConstant<size_t, T::value>;
+
+    template <typename T>
+    using IsEven = BoolConstant<T::value % 2 == 0>;
+
+    template <typename T>
+    struct Next : Identity<Number<T::value + 1>>
+    { };
+
+    // every value occurs twice in pseudo-random order (7919 is a prime)
+    template <size_t... Is>
+    auto make_numbers(std::index_sequence<Is...>) -> VT::TypeList<Number<(Is * 7919) % size / 2>...>;
+
+    using Numbers = decltype(make_numbers(std::make_index_sequence<size>{}));
+
+    using Unique = VT::Unique_t<Numbers>;
+    using Sorted = VT::Sort_t<Unique, Key>;
+    using Evens = VT::Filter_t<Sorted, IsEven>;
+    using Shifted = VT::Transform_t<Evens, Next>;
+
+    static_assert(VT::Size_v<Unique> == unique_count);
+    static_assert(std::is_same_v<VT::At_t<unique_count - 1, Sorted>, Number<unique_count - 1>>);
+    static_assert(VT::Size_v<Shifted> == (unique_count + 1) / 2);
+    static_assert(VT::Find_v<Number<1>, Shifted> == 0);
+    static_assert(VT::Contains_v<Number<0>, Numbers>);
+} // namespace
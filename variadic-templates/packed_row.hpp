@@ -0,0 +1,151 @@
+#ifndef VARIADIC_TEMPLATES_PACKED_ROW_HPP
+#define VARIADIC_TEMPLATES_PACKED_ROW_HPP
+
+#include "vt.hpp"
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace VT
+{
+    namespace details
+    {
+        template <typename... Types>
+        struct PackedLayout
+        {
+            static constexpr size_t count = sizeof...(Types);
+
+            // order[k] - original index of the item stored at position k
+            //  - stable insertion sort by descending alignment (std::stable_sort is not constexpr)
+            static constexpr std::array<size_t, count> order = [] {
+                constexpr std::array<size_t, count> alignments{alignof(Types)...};
+
+                std::array<size_t, count> indexes{};
+                for (size_t i = 0; i < count; ++i)
+                {
+                    size_t pos = i;
+                    for (; pos > 0 && alignments[indexes[pos - 1]] < alignments[i]; --pos)
+                        indexes[pos] = indexes[pos - 1];
+                    indexes[pos] = i;
+                }
+                return indexes;
+            }();
+
+            // position[i] - position where the item with original index i is stored
+            static constexpr std::array<size_t, count> position = [] {
+                std::array<size_t, count> positions{};
+                for (size_t k = 0; k < count; ++k)
+                    positions[order[k]] = k;
+                return positions;
+            }();
+
+            template <size_t... Ks>
+            static auto sorted_tuple(std::index_sequence<Ks...>) -> std::tuple<std::tuple_element_t<order[Ks], std::tuple<Types...>>...>;
+
+            using Storage = decltype(sorted_tuple(std::make_index_sequence<count>{}));
+        };
+    } // namespace details
+
+    /////////////////////////////////////////////////////////////////
+    // PackedRow - Row with members sorted by alignment
+    //
+    // Storing members in descending alignment order leaves no padding between them
+    // (only the tail is rounded up to the largest alignment), e.g.
+    // Row<char, double, int, char> takes 24 bytes, PackedRow<char, double, int, char> - 16.
+    // Items are still accessed by their original index (get<I>, structured bindings) -
+    // the index is mapped to a storage position at compile time.
+    //
+    template <typename... Types>
+    class PackedRow
+    {
+        using Layout = details::PackedLayout<Types...>;
+
+        typename Layout::Storage data_;
+
+        template <size_t... Ks, typename TTuple>
+        static typename Layout::Storage to_storage(std::index_sequence<Ks...>, TTuple&& values)
+        {
+            return {std::get<Layout::order[Ks]>(std::forward<TTuple>(values))...};
+        }
+
+    public:
+        static constexpr size_t size = sizeof...(Types);
+
+        PackedRow() = default;
+
+        explicit PackedRow(Types... values)
+            : data_{to_storage(std::make_index_sequence<size>{}, std::forward_as_tuple(std::move(values)...))}
+        { }
+
+        explicit PackedRow(const Row<Types...>& row)
+            : data_{to_storage(std::make_index_sequence<size>{}, row.data)}
+        { }
+
+        template <size_t I>
+        static constexpr size_t position_of()
+        {
+            return Layout::position[I];
+        }
+
+        template <size_t I>
+        auto& get() &
+        {
+            return std::get<position_of<I>()>(data_);
+        }
+
+        template <size_t I>
+        const auto& get() const&
+        {
+            return std::get<position_of<I>()>(data_);
+        }
+
+        template <size_t I>
+        auto&& get() &&
+        {
+            return std::get<position_of<I>()>(std::move(data_));
+        }
+
+        Row<Types...> to_row() const
+        {
+            return [this]<size_t... Is>(std::index_sequence<Is...>) {
+                return Row<Types...>{std::tuple<Types...>{get<Is>()...}};
+            }(std::index_sequence_for<Types...>{});
+        }
+
+        bool operator==(const PackedRow& other) const = default;
+    };
+
+    template <size_t I, typename... Types>
+    decltype(auto) get(PackedRow<Types...>& row)
+    {
+        return row.template get<I>();
+    }
+
+    template <size_t I, typename... Types>
+    decltype(auto) get(const PackedRow<Types...>& row)
+    {
+        return row.template get<I>();
+    }
+
+    template <size_t I, typename... Types>
+    decltype(auto) get(PackedRow<Types...>&& row)
+    {
+        return std::move(row).template get<I>();
+    }
+} // namespace VT
+
+// structured bindings
+template <typename... Types>
+struct std::tuple_size<VT::PackedRow<Types...>> : std::integral_constant<size_t, sizeof...(Types)>
+{ };
+
+template <size_t I, typename... Types>
+struct std::tuple_element<I, VT::PackedRow<Types...>>
+{
+    using type = std::tuple_element_t<I, std::tuple<Types...>>;
+};
+
+#endif
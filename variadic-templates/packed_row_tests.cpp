@@ -0,0 +1,101 @@
+#include "packed_row.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("PackedRow - layout")
+{
+    using Layout = VT::details::PackedLayout<char, double, int, char>;
+
+    STATIC_REQUIRE(Layout::order == std::array<size_t, 4>{1, 2, 0, 3});
+    STATIC_REQUIRE(Layout::position == std::array<size_t, 4>{2, 0, 1, 3});
+
+    STATIC_REQUIRE(sizeof(VT::Row<char, double, int, char>) == 24);
+    STATIC_REQUIRE(sizeof(VT::PackedRow<char, double, int, char>) == 16);
+
+    STATIC_REQUIRE(sizeof(VT::Row<char, double, char, double>) == 32);
+    STATIC_REQUIRE(sizeof(VT::PackedRow<char, double, char, double>) == 24);
+
+    STATIC_REQUIRE(sizeof(VT::Row<bool, int64_t, bool, int32_t, bool, int16_t>) == 32);
+    STATIC_REQUIRE(sizeof(VT::PackedRow<bool, int64_t, bool, int32_t, bool, int16_t>) == 24);
+
+    STATIC_REQUIRE(sizeof(VT::PackedRow<double, int, char>) == sizeof(VT::Row<double, int, char>));
+}
+
+TEST_CASE("PackedRow - access by original index")
+{
+    VT::PackedRow<char, double, int, std::string> row{'a', 3.14, 42, "text"};
+
+    SECTION("get")
+    {
+        REQUIRE(row.get<0>() == 'a');
+        REQUIRE(row.get<1>() == 3.14);
+        REQUIRE(VT::get<2>(row) == 42);
+        REQUIRE(VT::get<3>(row) == "text");
+
+        VT::get<2>(row) = 665;
+        REQUIRE(row.get<2>() == 665);
+
+        std::string text = VT::get<3>(std::move(row));
+        REQUIRE(text == "text");
+    }
+
+    SECTION("structured bindings")
+    {
+        auto& [c, d, i, s] = row;
+
+        REQUIRE(c == 'a');
+        REQUIRE(d == 3.14);
+        REQUIRE(i == 42);
+        REQUIRE(s == "text");
+
+        i = 13;
+        REQUIRE(row.get<2>() == 13);
+    }
+
+    SECTION("conversions from and to Row")
+    {
+        VT::Row<char, double, int, std::string> plain{{'b', 2.5, 7, "seven"}};
+        VT::PackedRow<char, double, int, std::string> packed{plain};
+
+        REQUIRE(packed == VT::PackedRow<char, double, int, std::string>{'b', 2.5, 7, "seven"});
+        REQUIRE(packed.to_row().data == plain.data);
+    }
+}
+
+TEST_CASE("PackedRow vs. Row - memory & scan", "[.][benchmark]")
+{
+    const size_t size = 1'000'000;
+
+    std::vector<VT::Row<char, double, int, char>> rows;
+    std::vector<VT::PackedRow<char, double, int, char>> packed_rows;
+    rows.reserve(size);
+    packed_rows.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        rows.push_back({{'a', i * 0.5, static_cast<int>(i), 'z'}});
+        packed_rows.emplace_back('a', i * 0.5, static_cast<int>(i), 'z');
+    }
+
+    BENCHMARK("scan Row - "s + std::to_string(size * sizeof(rows[0]) / 1024) + " KB")
+    {
+        double total = 0.0;
+        for (const auto& row : rows)
+            total += std::get<1>(row.data) + std::get<2>(row.data);
+        return total;
+    };
+
+    BENCHMARK("scan PackedRow - "s + std::to_string(size * sizeof(packed_rows[0]) / 1024) + " KB")
+    {
+        double total = 0.0;
+        for (const auto& row : packed_rows)
+            total += row.get<1>() + row.get<2>();
+        return total;
+    };
+}
@@ -0,0 +1,135 @@
+#ifndef VARIADIC_TEMPLATES_PRINT_TO_HPP
+#define VARIADIC_TEMPLATES_PRINT_TO_HPP
+
+#include <cassert>
+#include <charconv>
+#include <concepts>
+#include <cstddef>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <type_traits>
+
+namespace VT
+{
+    namespace details
+    {
+        template <typename T>
+        concept StringLike = std::convertible_to<const T&, std::string_view>;
+
+        // printed as a character by std::ostream (also int8_t & uint8_t)
+        template <typename T>
+        concept NarrowChar = std::same_as<T, char> || std::same_as<T, signed char> || std::same_as<T, unsigned char>;
+
+        // not accepted by std::to_chars (and not printable to std::ostream as characters)
+        template <typename T>
+        concept WideChar = std::same_as<T, wchar_t> || std::same_as<T, char8_t> || std::same_as<T, char16_t> || std::same_as<T, char32_t>;
+
+        template <typename T>
+        concept Formattable = (std::is_arithmetic_v<T> && !WideChar<T>) || StringLike<T>;
+
+        // upper bound of chars needed for a value of type T - 0 for strings (known only at runtime)
+        template <Formattable T>
+        constexpr size_t max_chars()
+        {
+            if constexpr (StringLike<T>)
+                return 0;
+            else if constexpr (std::is_same_v<T, bool> || NarrowChar<T>)
+                return 1;
+            else if constexpr (std::is_integral_v<T>)
+                return std::numeric_limits<T>::digits10 + 2; // sign & extra digit
+            else
+                return std::numeric_limits<T>::max_digits10 + 10; // sign, point & exponent: "e-4932"
+        }
+
+        template <Formattable T>
+        size_t dynamic_chars(const T& value)
+        {
+            if constexpr (StringLike<T>)
+                return std::string_view{value}.size();
+            else
+                return 0;
+        }
+
+        template <Formattable T>
+        char* format_to(char* pos, const T& value)
+        {
+            if constexpr (StringLike<T>)
+            {
+                std::string_view text{value};
+                return text.copy(pos, text.size()) + pos;
+            }
+            else if constexpr (std::is_same_v<T, bool>)
+            {
+                *pos = value ? '1' : '0'; // as std::cout without std::boolalpha
+                return pos + 1;
+            }
+            else if constexpr (NarrowChar<T>)
+            {
+                *pos = static_cast<char>(value);
+                return pos + 1;
+            }
+            else
+            {
+                auto [end, ec] = std::to_chars(pos, pos + max_chars<T>(), value);
+                assert(ec == std::errc{});
+                return end;
+            }
+        }
+
+        inline std::string& thread_buffer()
+        {
+            thread_local std::string buffer;
+            return buffer;
+        }
+    } // namespace details
+
+    /////////////////////////////////////////////////////////////////
+    // Buffered::print_to - the output of Folds::print without ostream formatting
+    //
+    // Numbers are formatted with std::to_chars (locale independent, floating point
+    // values in the shortest round-trip form). The size of the line is known
+    // at compile time for a pack of numbers (plus string lengths otherwise),
+    // so the buffer is resized once and the values are written without checks.
+    //
+    namespace Buffered
+    {
+        template <details::Formattable... Ts>
+        std::string_view print_to(std::string& buffer, const Ts&... values)
+        {
+            constexpr size_t fixed_chars = (details::max_chars<Ts>() + ... + 0) + sizeof...(Ts) + 1; // separators & "\n"
+
+            const size_t offset = buffer.size();
+            buffer.resize(offset + fixed_chars + (details::dynamic_chars(values) + ... + 0));
+
+            char* const first = buffer.data() + offset;
+            char* pos = first;
+            (..., (pos = details::format_to(pos, values), *pos++ = ' '));
+            *pos++ = '\n';
+
+            buffer.resize(pos - buffer.data());
+            return {first, pos};
+        }
+
+        // formats into a thread local buffer and sends it to out with a single write
+        template <details::Formattable... Ts>
+        void print_to(std::ostream& out, const Ts&... values)
+        {
+            std::string& buffer = details::thread_buffer();
+            buffer.clear();
+
+            print_to(buffer, values...);
+            out.write(buffer.data(), buffer.size());
+        }
+
+        template <details::Formattable... Ts>
+        void print(const Ts&... values)
+        {
+            print_to(std::cout, values...);
+        }
+    } // namespace Buffered
+} // namespace VT
+
+#endif
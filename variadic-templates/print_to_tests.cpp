@@ -0,0 +1,158 @@
+#include "print_to.hpp"
+#include "vt.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <limits>
+#include <sstream>
+#include <streambuf>
+#include <string>
+#include <version>
+
+#if __has_include(<format>)
+#include <format>
+#endif
+
+using namespace std::literals;
+
+namespace
+{
+    class CoutRedirect
+    {
+        std::streambuf* original_;
+
+    public:
+        explicit CoutRedirect(std::streambuf* buffer)
+            : original_{std::cout.rdbuf(buffer)}
+        { }
+
+        CoutRedirect(const CoutRedirect&) = delete;
+        CoutRedirect& operator=(const CoutRedirect&) = delete;
+
+        ~CoutRedirect()
+        {
+            std::cout.rdbuf(original_);
+        }
+    };
+
+    std::string folds_print_output(const auto&... values)
+    {
+        std::ostringstream out;
+        CoutRedirect redirect{out.rdbuf()};
+        VT::Folds::print(values...);
+        return out.str();
+    }
+} // namespace
+
+TEST_CASE("Buffered::print_to - same output as Folds::print")
+{
+    std::string buffer;
+
+    SECTION("numbers & text")
+    {
+        const std::string text = "text";
+        REQUIRE(VT::Buffered::print_to(buffer, 1, 2.5, -3L, 'c', true, text, "literal"sv, "c-string")
+                == folds_print_output(1, 2.5, -3L, 'c', true, text, "literal"sv, "c-string"));
+    }
+
+    SECTION("all narrow character types are printed as characters")
+    {
+        const int8_t i8 = 'a';
+        const uint8_t u8 = 'b';
+        const signed char sc = 'c';
+
+        REQUIRE(VT::Buffered::print_to(buffer, i8, u8, sc) == folds_print_output(i8, u8, sc));
+        REQUIRE(buffer == "a b c \n");
+    }
+
+    SECTION("wide characters are not formattable")
+    {
+        STATIC_REQUIRE_FALSE(VT::details::Formattable<wchar_t>);
+        STATIC_REQUIRE_FALSE(VT::details::Formattable<char8_t>);
+        STATIC_REQUIRE_FALSE(VT::details::Formattable<char16_t>);
+        STATIC_REQUIRE_FALSE(VT::details::Formattable<char32_t>);
+        STATIC_REQUIRE(VT::details::Formattable<int8_t>);
+    }
+
+    SECTION("empty pack")
+    {
+        REQUIRE(VT::Buffered::print_to(buffer) == "\n");
+    }
+
+    SECTION("appends to buffer")
+    {
+        VT::Buffered::print_to(buffer, 1, 2);
+        VT::Buffered::print_to(buffer, 3.25f);
+
+        REQUIRE(buffer == "1 2 \n3.25 \n");
+    }
+}
+
+TEST_CASE("Buffered::print_to - limits fit into the layout")
+{
+    std::string buffer;
+
+    VT::Buffered::print_to(buffer,
+        std::numeric_limits<int64_t>::min(), std::numeric_limits<uint64_t>::max(),
+        -std::numeric_limits<double>::denorm_min(), std::numeric_limits<double>::lowest(),
+        -std::numeric_limits<float>::min(), std::numeric_limits<long double>::lowest());
+
+    REQUIRE(buffer.starts_with("-9223372036854775808 18446744073709551615 -5e-324 -1.7976931348623157e+308 -1.1754944e-38 "));
+}
+
+TEST_CASE("Buffered::print_to - stream with single write")
+{
+    std::ostringstream out;
+
+    VT::Buffered::print_to(out, 42, "answer", 0.5);
+    VT::Buffered::print_to(out, 665);
+
+    REQUIRE(out.str() == "42 answer 0.5 \n665 \n");
+}
+
+namespace
+{
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override
+        {
+            return c;
+        }
+
+        std::streamsize xsputn(const char*, std::streamsize count) override
+        {
+            return count;
+        }
+    };
+} // namespace
+
+TEST_CASE("Buffered::print vs. Folds::print", "[.][benchmark]")
+{
+    NullBuffer null_buffer;
+    CoutRedirect redirect{&null_buffer};
+
+    const std::string name = "sensor";
+
+    BENCHMARK("Folds::print")
+    {
+        VT::Folds::print(1, 3.14, 665L, name, 0.001, 42u, -7, 2.71828);
+    };
+
+    BENCHMARK("Buffered::print")
+    {
+        VT::Buffered::print(1, 3.14, 665L, name, 0.001, 42u, -7, 2.71828);
+    };
+
+#if defined(__cpp_lib_format)
+    std::string buffer;
+
+    BENCHMARK("std::format_to")
+    {
+        buffer.clear();
+        std::format_to(std::back_inserter(buffer), "{} {} {} {} {} {} {} {} \n", 1, 3.14, 665L, name, 0.001, 42u, -7, 2.71828);
+        std::cout.write(buffer.data(), buffer.size());
+    };
+#endif
+}
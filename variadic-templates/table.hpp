@@ -0,0 +1,237 @@
+#ifndef VARIADIC_TEMPLATES_TABLE_HPP
+#define VARIADIC_TEMPLATES_TABLE_HPP
+
+#include "vt.hpp"
+
+#include <cstddef>
+#include <iterator>
+#include <new>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace VT
+{
+    // allocates on Alignment boundary (e.g. a cache line), so columns can be read with aligned SIMD loads
+    template <typename T, size_t Alignment = 64>
+    struct AlignedAllocator
+    {
+        using value_type = T;
+
+        template <typename U>
+        struct rebind
+        {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template <typename U>
+        AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept
+        { }
+
+        T* allocate(size_t n)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T), std::align_val_t{Alignment}));
+        }
+
+        void deallocate(T* ptr, size_t) noexcept
+        {
+            ::operator delete(ptr, std::align_val_t{Alignment});
+        }
+
+        template <typename U>
+        bool operator==(const AlignedAllocator<U, Alignment>&) const noexcept
+        {
+            return true;
+        }
+    };
+
+    /////////////////////////////////////////////////////////////////
+    // Table - columnar (structure of arrays) storage of Row<Types...>
+    //
+    // Every column is a separate contiguous array, so a scan of one column
+    // reads only the bytes of that column. Rows are accessed through proxies
+    // referring to items of all columns at the same position.
+    //
+    template <typename... Types>
+    class Table
+    {
+        static_assert(sizeof...(Types) > 0, "Table requires at least one column");
+
+        // vector<bool> is bit-packed - a column of bool could not be exposed as std::span<bool>
+        static_assert((!std::is_same_v<Types, bool> && ...), "Table does not support bool columns - use unsigned char");
+
+        template <typename T>
+        using Column = std::vector<T, AlignedAllocator<T>>;
+
+        std::tuple<Column<Types>...> columns_;
+
+        template <typename TTable>
+        class RowProxy
+        {
+            TTable* table_;
+            size_t index_;
+
+        public:
+            RowProxy(TTable* table, size_t index)
+                : table_{table}
+                , index_{index}
+            { }
+
+            template <size_t I>
+            decltype(auto) get() const
+            {
+                return std::get<I>(table_->columns_)[index_];
+            }
+
+            Row<Types...> to_row() const
+            {
+                return [this]<size_t... Is>(std::index_sequence<Is...>) {
+                    return Row<Types...>{std::tuple<Types...>{get<Is>()...}};
+                }(std::index_sequence_for<Types...>{});
+            }
+
+            operator Row<Types...>() const
+            {
+                return to_row();
+            }
+        };
+
+        template <typename TTable>
+        class Iterator
+        {
+            TTable* table_{};
+            size_t index_{};
+
+        public:
+            // operator* returns a proxy by value - a C++20 forward iterator, but only an input iterator for C++17 algorithms
+            using iterator_concept = std::forward_iterator_tag;
+            using iterator_category = std::input_iterator_tag;
+            using difference_type = std::ptrdiff_t;
+            using value_type = RowProxy<TTable>;
+            using reference = RowProxy<TTable>;
+
+            Iterator() = default;
+
+            Iterator(TTable* table, size_t index)
+                : table_{table}
+                , index_{index}
+            { }
+
+            RowProxy<TTable> operator*() const
+            {
+                return {table_, index_};
+            }
+
+            Iterator& operator++()
+            {
+                ++index_;
+                return *this;
+            }
+
+            Iterator operator++(int)
+            {
+                Iterator temp = *this;
+                ++index_;
+                return temp;
+            }
+
+            bool operator==(const Iterator& other) const = default;
+        };
+
+    public:
+        using row_type = Row<Types...>;
+        using reference = RowProxy<Table>;
+        using const_reference = RowProxy<const Table>;
+        using iterator = Iterator<Table>;
+        using const_iterator = Iterator<const Table>;
+
+        // if any push_back throws, items already appended to other columns are removed,
+        // so all columns keep the same length
+        void append(Types... values)
+        {
+            size_t pushed = 0;
+
+            try
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    ((std::get<Is>(columns_).push_back(std::move(values)), ++pushed), ...);
+                }(std::index_sequence_for<Types...>{});
+            }
+            catch (...)
+            {
+                [&]<size_t... Is>(std::index_sequence<Is...>) {
+                    ((Is < pushed ? std::get<Is>(columns_).pop_back() : void()), ...);
+                }(std::index_sequence_for<Types...>{});
+                throw;
+            }
+        }
+
+        void append(const Row<Types...>& row)
+        {
+            std::apply([this](const auto&... values) { append(values...); }, row.data);
+        }
+
+        void reserve(size_t size)
+        {
+            std::apply([size](auto&... columns) { (columns.reserve(size), ...); }, columns_);
+        }
+
+        size_t size() const
+        {
+            return std::get<0>(columns_).size();
+        }
+
+        bool empty() const
+        {
+            return size() == 0;
+        }
+
+        template <size_t I>
+        auto column()
+        {
+            return std::span{std::get<I>(columns_)};
+        }
+
+        template <size_t I>
+        auto column() const
+        {
+            return std::span{std::get<I>(columns_)};
+        }
+
+        reference operator[](size_t index)
+        {
+            return {this, index};
+        }
+
+        const_reference operator[](size_t index) const
+        {
+            return {this, index};
+        }
+
+        iterator begin()
+        {
+            return {this, 0};
+        }
+
+        iterator end()
+        {
+            return {this, size()};
+        }
+
+        const_iterator begin() const
+        {
+            return {this, 0};
+        }
+
+        const_iterator end() const
+        {
+            return {this, size()};
+        }
+    };
+} // namespace VT
+
+#endif
@@ -0,0 +1,145 @@
+#include "table.hpp"
+
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("Table - columnar storage of rows")
+{
+    VT::Table<int, double, std::string> table;
+
+    table.append(1, 1.5, "one");
+    table.append(VT::Row<int, double, std::string>{{2, 2.5, "two"}});
+    table.append(3, 3.5, "three");
+
+    REQUIRE(table.size() == 3);
+
+    SECTION("columns are contiguous spans")
+    {
+        std::span<double> prices = table.column<1>();
+
+        REQUIRE(prices.size() == 3);
+        REQUIRE(std::accumulate(prices.begin(), prices.end(), 0.0) == 7.5);
+        REQUIRE(reinterpret_cast<uintptr_t>(prices.data()) % 64 == 0);
+
+        prices[0] = 10.0;
+        REQUIRE(table[0].get<1>() == 10.0);
+    }
+
+    SECTION("row proxies")
+    {
+        auto row = table[1];
+        REQUIRE(row.get<0>() == 2);
+        REQUIRE(row.get<2>() == "two");
+
+        row.get<2>() = "TWO";
+        REQUIRE(table.column<2>()[1] == "TWO");
+
+        VT::Row<int, double, std::string> copy = table[2];
+        REQUIRE(copy.data == std::tuple{3, 3.5, "three"s});
+    }
+
+    SECTION("iteration")
+    {
+        const auto& const_table = table;
+
+        std::vector<std::string> names;
+        for (auto row : const_table)
+            names.push_back(row.get<2>());
+
+        REQUIRE(names == std::vector{"one"s, "two"s, "three"s});
+
+        using Iterator = VT::Table<int, double, std::string>::const_iterator;
+        static_assert(std::forward_iterator<Iterator>);
+        static_assert(std::is_same_v<std::iterator_traits<Iterator>::iterator_category, std::input_iterator_tag>);
+    }
+}
+
+namespace
+{
+    // moving throws when armed
+    struct ThrowingMove
+    {
+        inline static bool armed = false;
+
+        ThrowingMove() = default;
+        ThrowingMove(const ThrowingMove&) = default;
+        ThrowingMove& operator=(const ThrowingMove&) = default;
+
+        ThrowingMove(ThrowingMove&&)
+        {
+            if (armed)
+                throw std::runtime_error("move failed");
+        }
+    };
+} // namespace
+
+TEST_CASE("Table - failed append keeps columns of equal length")
+{
+    VT::Table<int, std::string, ThrowingMove> table;
+    table.append(1, "one", ThrowingMove{});
+
+    ThrowingMove::armed = true;
+    REQUIRE_THROWS_AS(table.append(2, "two", ThrowingMove{}), std::runtime_error);
+    ThrowingMove::armed = false;
+
+    REQUIRE(table.size() == 1);
+    REQUIRE(table.column<0>().size() == 1);
+    REQUIRE(table.column<1>().size() == 1);
+    REQUIRE(table.column<2>().size() == 1);
+}
+
+TEST_CASE("Table vs. vector<Row> - scan of one column", "[.][benchmark]")
+{
+    const size_t size = 10'000'000;
+
+    std::vector<VT::Row<int, double, int64_t, float>> rows;
+    VT::Table<int, double, int64_t, float> table;
+    rows.reserve(size);
+    table.reserve(size);
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        rows.push_back({{static_cast<int>(i), i * 0.5, static_cast<int64_t>(i), i * 0.25f}});
+        table.append(static_cast<int>(i), i * 0.5, static_cast<int64_t>(i), i * 0.25f);
+    }
+
+    BENCHMARK("vector<Row> - sum of double column")
+    {
+        double total = 0.0;
+        for (const auto& row : rows)
+            total += std::get<1>(row.data);
+        return total;
+    };
+
+    BENCHMARK("Table - sum of double column")
+    {
+        double total = 0.0;
+        for (double value : table.column<1>())
+            total += value;
+        return total;
+    };
+
+    BENCHMARK("vector<Row> - sum of float column")
+    {
+        float total = 0.0f;
+        for (const auto& row : rows)
+            total += std::get<3>(row.data);
+        return total;
+    };
+
+    BENCHMARK("Table - sum of float column")
+    {
+        float total = 0.0f;
+        for (float value : table.column<3>())
+            total += value;
+        return total;
+    };
+}
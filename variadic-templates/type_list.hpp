@@ -0,0 +1,338 @@
+#ifndef VARIADIC_TEMPLATES_TYPE_LIST_HPP
+#define VARIADIC_TEMPLATES_TYPE_LIST_HPP
+
+#include "type_traits.hpp" // Identity, IntegralConstant
+#include "vt.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+/////////////////////////////////////////////////////////////////
+// TypeList - metafunctions with constant instantiation depth
+//
+// Recursive Head-Tail metafunctions (as VT::Count) instantiate one class per type,
+// nested as deep as the list is long. Here every algorithm computes indexes
+// in a constexpr function and expands the result in a single pack expansion
+// of At - pack indexing (C++26), __type_pack_element or one multiple-inheritance
+// lookup table - so the depth does not depend on the length of the list.
+// Without the builtins every lookup in the table is linear in the length of the list.
+//
+namespace VT
+{
+    template <typename... Ts>
+    struct TypeList
+    { };
+
+    namespace details
+    {
+        // Pack<Ts...>::At<I> - instantiated once per list; the alias does not create a class
+        // with all Ts per index, so picking K types from N costs O(N + K) instead of O(N * K)
+#if defined(__cpp_pack_indexing)
+        template <typename... Ts>
+        struct Pack
+        {
+            template <size_t I>
+            using At = Ts...[I];
+        };
+#elif defined(__has_builtin) && __has_builtin(__type_pack_element)
+        template <typename... Ts>
+        struct Pack
+        {
+            template <size_t I>
+            using At = __type_pack_element<I, Ts...>;
+        };
+#else
+        template <size_t I, typename T>
+        struct Indexed
+        { };
+
+        template <typename TIndexes, typename... Ts>
+        struct IndexedPack;
+
+        template <size_t... Is, typename... Ts>
+        struct IndexedPack<std::index_sequence<Is...>, Ts...> : Indexed<Is, Ts>...
+        { };
+
+        // I is given - T is deduced from the only base Indexed<I, T>
+        template <size_t I, typename T>
+        Identity<T> select(const Indexed<I, T>&);
+
+        template <typename... Ts>
+        struct Pack
+        {
+            using Lookup = IndexedPack<std::index_sequence_for<Ts...>, Ts...>;
+
+            template <size_t I>
+            using At = typename decltype(select<I>(std::declval<const Lookup&>()))::type;
+        };
+#endif
+
+        template <size_t N>
+        constexpr size_t find_first(const std::array<bool, N>& matches)
+        {
+            for (size_t i = 0; i < N; ++i)
+                if (matches[i])
+                    return i;
+            return N;
+        }
+
+        template <auto Flags>
+        constexpr auto indexes_of_set_flags()
+        {
+            constexpr size_t count = [] {
+                size_t result = 0;
+                for (bool flag : Flags)
+                    result += flag;
+                return result;
+            }();
+
+            std::array<size_t, count> indexes{};
+            for (size_t i = 0, pos = 0; i < Flags.size(); ++i)
+                if (Flags[i])
+                    indexes[pos++] = i;
+            return indexes;
+        }
+
+        // stable bottom-up merge sort of indexes by keys
+        //  - raw pointers and a swap of buffers instead of operator[], std::min and array copies,
+        //    as every call counts against the step limit of constant evaluation
+        template <typename TKey, size_t N>
+        constexpr std::array<size_t, N> sorted_indexes(const std::array<TKey, N>& keys)
+        {
+            std::array<size_t, N> buffers[2]{};
+            for (size_t i = 0; i < N; ++i)
+                buffers[0][i] = i;
+
+            const TKey* const key = keys.data();
+            size_t current = 0;
+            for (size_t width = 1; width < N; width *= 2, current ^= 1)
+            {
+                const size_t* const from = buffers[current].data();
+                size_t* const to = buffers[current ^ 1].data();
+
+                for (size_t first = 0; first < N; first += 2 * width)
+                {
+                    const size_t middle = first + width < N ? first + width : N;
+                    const size_t last = first + 2 * width < N ? first + 2 * width : N;
+
+                    size_t left = first, right = middle, pos = first;
+                    while (left < middle && right < last)
+                        to[pos++] = key[from[right]] < key[from[left]] ? from[right++] : from[left++];
+                    while (left < middle)
+                        to[pos++] = from[left++];
+                    while (right < last)
+                        to[pos++] = from[right++];
+                }
+            }
+
+            return buffers[current];
+        }
+
+        // the length is taken from the array - char_traits::length would walk the whole signature
+        template <typename T>
+        constexpr std::string_view signature()
+        {
+#if defined(_MSC_VER)
+            return {__FUNCSIG__, sizeof(__FUNCSIG__) - 1};
+#else
+            return {__PRETTY_FUNCTION__, sizeof(__PRETTY_FUNCTION__) - 1};
+#endif
+        }
+
+        struct SignatureLayout
+        {
+            size_t prefix;
+            size_t suffix;
+        };
+
+        inline constexpr SignatureLayout signature_layout = [] {
+            constexpr std::string_view probe = signature<void>();
+            constexpr size_t prefix = probe.find("void");
+            return SignatureLayout{prefix, probe.size() - prefix - std::string_view{"void"}.size()};
+        }();
+
+        // name of T - the signature without the parts common to all instantiations
+        //  - equal types have equal names, but distinct types may share a name
+        //    (e.g. closures printed as "<lambda()>" or local classes of different functions)
+        template <typename T>
+        constexpr std::string_view type_name()
+        {
+            const std::string_view name = signature<T>();
+            return name.substr(signature_layout.prefix, name.size() - signature_layout.prefix - signature_layout.suffix);
+        }
+
+        template <typename TList, auto Indexes, typename TPositions = std::make_index_sequence<Indexes.size()>>
+        struct Pick;
+    } // namespace details
+
+    template <typename TList>
+    struct Size;
+
+    template <typename... Ts>
+    struct Size<TypeList<Ts...>> : IntegralConstant<size_t, Shorter::Count<Ts...>::value>
+    { };
+
+    template <typename TList>
+    constexpr size_t Size_v = Size<TList>::value;
+
+    ///////////////////////////////////////////////////////////
+    // At
+
+    template <size_t I, typename TList>
+    struct At;
+
+    template <size_t I, typename... Ts>
+    struct At<I, TypeList<Ts...>> : Identity<typename details::Pack<Ts...>::template At<I>>
+    {
+        static_assert(I < sizeof...(Ts), "index out of range");
+    };
+
+    template <size_t I, typename TList>
+    using At_t = typename At<I, TList>::type;
+
+    namespace details
+    {
+        // TypeList<At_t<Indexes[0], TList>, At_t<Indexes[1], TList>, ...> - without instantiating At per index
+        template <typename... Ts, auto Indexes, size_t... Ks>
+        struct Pick<TypeList<Ts...>, Indexes, std::index_sequence<Ks...>>
+            : Identity<TypeList<typename Pack<Ts...>::template At<Indexes[Ks]>...>>
+        { };
+    } // namespace details
+
+    ///////////////////////////////////////////////////////////
+    // Find - index of the first T or Size_v<TList> if absent
+
+    template <typename T, typename TList>
+    struct Find;
+
+    template <typename T, typename... Ts>
+    struct Find<T, TypeList<Ts...>>
+        : IntegralConstant<size_t, details::find_first(std::array<bool, sizeof...(Ts)>{std::is_same_v<T, Ts>...})>
+    { };
+
+    template <typename T, typename TList>
+    constexpr size_t Find_v = Find<T, TList>::value;
+
+    template <typename T, typename TList>
+    constexpr bool Contains_v = Find_v<T, TList> < Size_v<TList>;
+
+    ///////////////////////////////////////////////////////////
+    // Transform - TypeList<F<Ts>::type...>
+
+    template <typename TList, template <typename> class F>
+    struct Transform;
+
+    template <typename... Ts, template <typename> class F>
+    struct Transform<TypeList<Ts...>, F> : Identity<TypeList<typename F<Ts>::type...>>
+    { };
+
+    template <typename TList, template <typename> class F>
+    using Transform_t = typename Transform<TList, F>::type;
+
+    ///////////////////////////////////////////////////////////
+    // Filter - types for which Predicate<T>::value is true (in the original order)
+
+    template <typename TList, template <typename> class Predicate>
+    struct Filter;
+
+    template <typename... Ts, template <typename> class Predicate>
+    struct Filter<TypeList<Ts...>, Predicate>
+        : details::Pick<TypeList<Ts...>,
+              details::indexes_of_set_flags<std::array<bool, sizeof...(Ts)>{static_cast<bool>(Predicate<Ts>::value)...}>()>
+    { };
+
+    template <typename TList, template <typename> class Predicate>
+    using Filter_t = typename Filter<TList, Predicate>::type;
+
+    ///////////////////////////////////////////////////////////
+    // Unique - first occurrences of types (in the original order)
+
+    namespace details
+    {
+        constexpr uint64_t fnv1a_hash(std::string_view name)
+        {
+            uint64_t hash = 0xcbf29ce484222325ULL;
+            for (const char *c = name.data(), *end = c + name.size(); c != end; ++c)
+            {
+                hash ^= static_cast<unsigned char>(*c);
+                hash *= 0x100000001b3ULL;
+            }
+            return hash;
+        }
+
+        // unique address per type - &type_id<T> == &type_id<U> iff std::is_same_v<T, U>,
+        // and comparing the addresses for equality is a constant expression
+        template <typename T>
+        inline constexpr char type_id{};
+
+        // O(N log N) - equal types are adjacent after a stable sort of indexes by hash of their names
+        //  - the hash only groups candidates, types within runs of equal hashes are compared by type_id
+        //  - the first of each run of identical types has the lowest index
+        template <size_t N>
+        constexpr std::array<bool, N> first_occurrences(const std::array<std::string_view, N>& names, const std::array<const char*, N>& ids)
+        {
+            std::array<uint64_t, N> hashes{};
+            for (size_t i = 0; i < N; ++i)
+                hashes[i] = fnv1a_hash(names[i]);
+
+            const std::array<size_t, N> sorted = sorted_indexes(hashes);
+            const size_t* const order = sorted.data();
+            const uint64_t* const hash = hashes.data();
+            const char* const* const id = ids.data();
+
+            std::array<bool, N> result{};
+            bool* const flags = result.data();
+            for (size_t k = 0, run = 0; k < N; ++k)
+            {
+                if (hash[order[k]] != hash[order[run]])
+                    run = k;
+
+                flags[order[k]] = true;
+                for (size_t j = run; j < k && flags[order[k]]; ++j)
+                    flags[order[k]] = !(flags[order[j]] && id[order[j]] == id[order[k]]);
+            }
+            return result;
+        }
+    } // namespace details
+
+    template <typename TList>
+    struct Unique;
+
+    template <typename... Ts>
+    struct Unique<TypeList<Ts...>>
+        : details::Pick<TypeList<Ts...>,
+              details::indexes_of_set_flags<details::first_occurrences(
+                  std::array<std::string_view, sizeof...(Ts)>{details::type_name<Ts>()...},
+                  std::array<const char*, sizeof...(Ts)>{&details::type_id<Ts>...})>()>
+    { };
+
+    template <typename TList>
+    using Unique_t = typename Unique<TList>::type;
+
+    ///////////////////////////////////////////////////////////
+    // Sort - stable sort by Key<T>::value (ascending)
+    //  - types are ordered by a constexpr key (e.g. alignment or size),
+    //    so only one Key is instantiated per type
+
+    template <typename TList, template <typename> class Key>
+    struct Sort;
+
+    template <typename... Ts, template <typename> class Key>
+    struct Sort<TypeList<Ts...>, Key>
+        : details::Pick<TypeList<Ts...>, details::sorted_indexes(std::array{Key<Ts>::value...})>
+    { };
+
+    template <template <typename> class Key>
+    struct Sort<TypeList<>, Key> : Identity<TypeList<>>
+    { };
+
+    template <typename TList, template <typename> class Key>
+    using Sort_t = typename Sort<TList, Key>::type;
+} // namespace VT
+
+#endif
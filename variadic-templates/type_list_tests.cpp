@@ -0,0 +1,124 @@
+#include "type_list.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    using Types = VT::TypeList<char, double, int, char, std::string, int, double>;
+
+    template <typename T>
+    struct AddPointer : Identity<T*>
+    { };
+
+    template <typename T>
+    using IsArithmetic = BoolConstant<std::is_arithmetic_v<T>>;
+
+    template <typename T>
+    using Alignment = IntegralConstant<size_t, alignof(T)>;
+
+    template <size_t N>
+    using Number = IntegralConstant<size_t, N>;
+
+    template <typename T>
+    struct Negative : IntegralConstant<long long, -static_cast<long long>(T::value)>
+    { };
+
+    template <size_t... Is>
+    auto make_numbers(std::index_sequence<Is...>) -> VT::TypeList<Number<(Is * 7919) % 256>...>;
+} // namespace
+
+TEST_CASE("TypeList - Size & At")
+{
+    STATIC_REQUIRE(VT::Size_v<Types> == 7);
+    STATIC_REQUIRE(VT::Size_v<VT::TypeList<>> == 0);
+
+    STATIC_REQUIRE(std::is_same_v<VT::At_t<0, Types>, char>);
+    STATIC_REQUIRE(std::is_same_v<VT::At_t<4, Types>, std::string>);
+    STATIC_REQUIRE(std::is_same_v<VT::At_t<6, Types>, double>);
+}
+
+TEST_CASE("TypeList - Find")
+{
+    STATIC_REQUIRE(VT::Find_v<int, Types> == 2);
+    STATIC_REQUIRE(VT::Find_v<std::string, Types> == 4);
+    STATIC_REQUIRE(VT::Find_v<float, Types> == VT::Size_v<Types>);
+
+    STATIC_REQUIRE(VT::Contains_v<double, Types>);
+    STATIC_REQUIRE_FALSE(VT::Contains_v<float, Types>);
+    STATIC_REQUIRE_FALSE(VT::Contains_v<int, VT::TypeList<>>);
+}
+
+TEST_CASE("TypeList - Transform & Filter")
+{
+    STATIC_REQUIRE(std::is_same_v<VT::Transform_t<VT::TypeList<int, const char>, AddPointer>, VT::TypeList<int*, const char*>>);
+    STATIC_REQUIRE(std::is_same_v<VT::Transform_t<VT::TypeList<>, AddPointer>, VT::TypeList<>>);
+
+    STATIC_REQUIRE(std::is_same_v<VT::Filter_t<Types, IsArithmetic>, VT::TypeList<char, double, int, char, int, double>>);
+    STATIC_REQUIRE(std::is_same_v<VT::Filter_t<Types, std::is_class>, VT::TypeList<std::string>>);
+    STATIC_REQUIRE(std::is_same_v<VT::Filter_t<Types, std::is_pointer>, VT::TypeList<>>);
+}
+
+namespace
+{
+    // both types are printed as "make_locals()::<lambda()>::Local"
+    auto make_locals()
+    {
+        auto local_1 = [] { struct Local { }; return Local{}; }();
+        auto local_2 = [] { struct Local { }; return Local{}; }();
+        return std::pair{local_1, local_2};
+    }
+} // namespace
+
+TEST_CASE("TypeList - Unique")
+{
+    STATIC_REQUIRE(std::is_same_v<VT::Unique_t<Types>, VT::TypeList<char, double, int, std::string>>);
+    STATIC_REQUIRE(std::is_same_v<VT::Unique_t<VT::TypeList<int, int, int>>, VT::TypeList<int>>);
+    STATIC_REQUIRE(std::is_same_v<VT::Unique_t<VT::TypeList<>>, VT::TypeList<>>);
+
+    SECTION("distinct types with the same name (GCC prints both lambdas as \"<lambda()>\")")
+    {
+        auto l1 = [] { };
+        auto l2 = [] { };
+        using Lambda1 = decltype(l1);
+        using Lambda2 = decltype(l2);
+        using Local1 = decltype(make_locals().first);
+        using Local2 = decltype(make_locals().second);
+
+        STATIC_REQUIRE(std::is_same_v<VT::Unique_t<VT::TypeList<Lambda1, Lambda2, int, Lambda1, Lambda2, int>>,
+                                      VT::TypeList<Lambda1, Lambda2, int>>);
+        STATIC_REQUIRE(std::is_same_v<VT::Unique_t<VT::TypeList<Local1, Local2, Local1, Local2>>, VT::TypeList<Local1, Local2>>);
+    }
+}
+
+TEST_CASE("TypeList - Sort")
+{
+    SECTION("stable")
+    {
+        using Sorted = VT::Sort_t<VT::TypeList<double, char, int64_t, int16_t, bool, int32_t>, Alignment>;
+
+        STATIC_REQUIRE(std::is_same_v<Sorted, VT::TypeList<char, bool, int16_t, int32_t, double, int64_t>>);
+        STATIC_REQUIRE(std::is_same_v<VT::Sort_t<VT::TypeList<>, Alignment>, VT::TypeList<>>);
+    }
+
+    SECTION("descending by negated key")
+    {
+        using Sorted = VT::Sort_t<VT::TypeList<Number<3>, Number<1>, Number<4>, Number<1>, Number<5>>, Negative>;
+
+        STATIC_REQUIRE(std::is_same_v<Sorted, VT::TypeList<Number<5>, Number<4>, Number<3>, Number<1>, Number<1>>>);
+    }
+
+    SECTION("long lists")
+    {
+        using Numbers = decltype(make_numbers(std::make_index_sequence<1000>{}));
+        using Sorted = VT::Sort_t<VT::Unique_t<Numbers>, Negative>;
+
+        STATIC_REQUIRE(VT::Size_v<Sorted> == 256);
+        STATIC_REQUIRE(std::is_same_v<VT::At_t<0, Sorted>, Number<255>>);
+        STATIC_REQUIRE(std::is_same_v<VT::At_t<255, Sorted>, Number<0>>);
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef VARIADIC_TEMPLATES_VT_HPP
+#define VARIADIC_TEMPLATES_VT_HPP
+
+#include <cstddef>
+#include <iostream>
+#include <tuple>
+
+namespace VT
+{
+    template <typename... Types>
+    struct Row
+    {
+        std::tuple<Types...> data;
+    };
+
+    template <typename... Types>
+    struct Pointers
+    {
+        std::tuple<const Types*...> pointers;
+    };
+
+    template <typename... TArgs>
+    void eat_anything(TArgs&&... args)
+    {
+    }
+} // namespace VT
+
+///////////////////////////////////////////////////////////////////
+// idiom Head-Tail
+namespace VT
+{
+    // void print()
+    // {
+    //     std::cout << "\n";
+    // }
+
+    template <typename THead, typename... TTail>
+    void print(const THead& head, const TTail&... tail)
+    {
+        std::cout << head << " ";
+
+        if constexpr(sizeof...(tail) > 0)
+        {
+            print(tail...);
+        }
+        else
+        {
+            std::cout << "\n";
+        }        
+    }
+
+    namespace Folds
+    {
+        void print(const auto&... values)
+        {
+            //(std::cout << ... << values) << "\n"; // binary left fold: (start << ... << pack)
+
+            (..., (std::cout << values << " ")) << "\n"; // operator ,
+        }
+    }
+
+    //////////////////////////////////////////////////////////
+
+    template <typename... Ts>
+    struct Count;
+
+    template <typename THead, typename... TTail>
+    struct Count<THead, TTail...>
+    {
+        static constexpr size_t value = 1 + Count<TTail...>::value;
+    };
+
+    template <>
+    struct Count<>
+    {
+        static constexpr size_t value = 0;
+    };
+
+    namespace Shorter
+    {
+        template <typename... Ts>
+        struct Count
+        {
+            constexpr static size_t value = sizeof...(Ts);
+        };
+    }
+} // namespace VT
+
+///////////////////////////////////////////////////////////
+
+namespace VT
+{
+    template <size_t... Is>
+    struct Indexes
+    {};
+
+    template <size_t... Is, typename Tpl>
+    auto cherry_pick(const Tpl& tpl)
+    {
+        return std::tuple{std::get<Is>(tpl)...}; // std::tuple{std::get<0>(tpl), std::get<2>(tpl)};
+    }
+} // namespace VT
+
+#endif
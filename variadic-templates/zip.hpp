@@ -0,0 +1,173 @@
+#ifndef VARIADIC_TEMPLATES_ZIP_HPP
+#define VARIADIC_TEMPLATES_ZIP_HPP
+
+#include "vt.hpp"
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <tuple>
+#include <utility>
+#include <version>
+
+namespace VT
+{
+    /////////////////////////////////////////////////////////////////
+    // ZipRange - lockstep traversal of the arrays pointed by Pointers<Types...>
+    //
+    // The iterator keeps the base pointers and one index, and dereferencing
+    // yields std::tuple<const Types&...> of base[index] - the same loads as
+    // a hand-written index loop, so the loop still can be auto-vectorized.
+    //
+    template <typename... Types>
+    class ZipIterator
+    {
+        std::tuple<const Types*...> bases_{};
+        std::ptrdiff_t index_{};
+
+    public:
+        using iterator_concept = std::random_access_iterator_tag;
+        using iterator_category = std::random_access_iterator_tag;
+        using reference = std::tuple<const Types&...>;
+#if defined(__cpp_lib_ranges_zip)
+        using value_type = std::tuple<Types...>;
+#else
+        using value_type = reference; // common_reference of tuples is a C++23 library feature
+#endif
+        using difference_type = std::ptrdiff_t;
+
+        ZipIterator() = default;
+
+        ZipIterator(const std::tuple<const Types*...>& bases, std::ptrdiff_t index)
+            : bases_{bases}
+            , index_{index}
+        { }
+
+        reference operator*() const
+        {
+            return (*this)[0];
+        }
+
+        reference operator[](difference_type offset) const
+        {
+            return std::apply([i = index_ + offset](const Types*... bases) { return reference{bases[i]...}; }, bases_);
+        }
+
+        ZipIterator& operator++()
+        {
+            ++index_;
+            return *this;
+        }
+
+        ZipIterator operator++(int)
+        {
+            ZipIterator temp = *this;
+            ++index_;
+            return temp;
+        }
+
+        ZipIterator& operator--()
+        {
+            --index_;
+            return *this;
+        }
+
+        ZipIterator operator--(int)
+        {
+            ZipIterator temp = *this;
+            --index_;
+            return temp;
+        }
+
+        ZipIterator& operator+=(difference_type offset)
+        {
+            index_ += offset;
+            return *this;
+        }
+
+        ZipIterator& operator-=(difference_type offset)
+        {
+            index_ -= offset;
+            return *this;
+        }
+
+        friend ZipIterator operator+(ZipIterator it, difference_type offset)
+        {
+            return it += offset;
+        }
+
+        friend ZipIterator operator+(difference_type offset, ZipIterator it)
+        {
+            return it += offset;
+        }
+
+        friend ZipIterator operator-(ZipIterator it, difference_type offset)
+        {
+            return it -= offset;
+        }
+
+        friend difference_type operator-(const ZipIterator& lhs, const ZipIterator& rhs)
+        {
+            return lhs.index_ - rhs.index_;
+        }
+
+        // iterators of the same range share base pointers - only indexes are compared
+        friend bool operator==(const ZipIterator& lhs, const ZipIterator& rhs)
+        {
+            return lhs.index_ == rhs.index_;
+        }
+
+        friend std::strong_ordering operator<=>(const ZipIterator& lhs, const ZipIterator& rhs)
+        {
+            return lhs.index_ <=> rhs.index_;
+        }
+    };
+
+    template <typename... Types>
+    class ZipRange
+    {
+        std::tuple<const Types*...> bases_;
+        size_t size_;
+
+    public:
+        ZipRange(const Pointers<Types...>& pointers, size_t size)
+            : bases_{pointers.pointers}
+            , size_{size}
+        { }
+
+        ZipIterator<Types...> begin() const
+        {
+            return {bases_, 0};
+        }
+
+        ZipIterator<Types...> end() const
+        {
+            return {bases_, static_cast<std::ptrdiff_t>(size_)};
+        }
+
+        size_t size() const
+        {
+            return size_;
+        }
+
+        std::tuple<const Types&...> operator[](size_t index) const
+        {
+            return begin()[static_cast<std::ptrdiff_t>(index)];
+        }
+    };
+
+    // every pointer must point to (at least) size items
+    template <typename... Types>
+    ZipRange<Types...> zip(const Pointers<Types...>& pointers, size_t size)
+    {
+        return {pointers, size};
+    }
+
+    template <typename... Types>
+    ZipRange<Types...> zip(size_t size, const Types*... bases)
+    {
+        return {Pointers<Types...>{{bases...}}, size};
+    }
+} // namespace VT
+
+#endif
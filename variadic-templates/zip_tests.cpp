@@ -0,0 +1,135 @@
+#include "zip.hpp"
+
+#include <algorithm>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <iterator>
+#include <numeric>
+#include <ranges>
+#include <string>
+#include <vector>
+
+using namespace std::literals;
+
+TEST_CASE("zip over Pointers")
+{
+    const std::vector<int> ids = {1, 2, 3, 4};
+    const std::vector<double> prices = {1.5, 2.5, 3.5, 4.5};
+    const std::vector<std::string> names = {"one", "two", "three", "four"};
+
+    VT::Pointers<int, double, std::string> pointers{{ids.data(), prices.data(), names.data()}};
+    auto rows = VT::zip(pointers, ids.size());
+
+    STATIC_REQUIRE(std::random_access_iterator<decltype(rows.begin())>);
+    STATIC_REQUIRE(std::ranges::random_access_range<decltype(rows)>);
+
+    SECTION("tuples of references")
+    {
+        std::vector<std::string> visited;
+
+        for (auto [id, price, name] : rows)
+        {
+            REQUIRE(&id == &ids[visited.size()]);
+            visited.push_back(std::to_string(id) + ":" + name);
+        }
+
+        REQUIRE(visited == std::vector{"1:one"s, "2:two"s, "3:three"s, "4:four"s});
+    }
+
+    SECTION("random access")
+    {
+        REQUIRE(rows.size() == 4);
+        REQUIRE(std::get<2>(rows[2]) == "three");
+
+        auto it = rows.begin() + 3;
+        REQUIRE(std::get<1>(*it) == 4.5);
+        REQUIRE(std::get<0>(it[-2]) == 2);
+        REQUIRE(it - rows.begin() == 3);
+        REQUIRE(rows.end() - rows.begin() == 4);
+        REQUIRE(rows.begin() < it);
+    }
+
+    SECTION("standard algorithms")
+    {
+        auto found = std::find_if(rows.begin(), rows.end(), [](const auto& row) { return std::get<1>(row) > 3.0; });
+        REQUIRE(std::get<2>(*found) == "three");
+
+        auto reversed = rows | std::views::reverse;
+        REQUIRE(std::get<0>(*reversed.begin()) == 4);
+    }
+}
+
+namespace
+{
+    double dot_index_loop(const float* a, const float* b, size_t size)
+    {
+        double total = 0.0;
+        for (size_t i = 0; i < size; ++i)
+            total += a[i] * b[i];
+        return total;
+    }
+
+    double dot_zip(const float* a, const float* b, size_t size)
+    {
+        double total = 0.0;
+        for (auto [x, y] : VT::zip(size, a, b))
+            total += x * y;
+        return total;
+    }
+
+    void saxpy_index_loop(float factor, const float* x, const float* y, float* out, size_t size)
+    {
+        for (size_t i = 0; i < size; ++i)
+            out[i] = factor * x[i] + y[i];
+    }
+
+    void saxpy_zip(float factor, const float* x, const float* y, float* out, size_t size)
+    {
+        auto rows = VT::zip(size, x, y);
+        for (size_t i = 0; auto [xi, yi] : rows)
+            out[i++] = factor * xi + yi;
+    }
+} // namespace
+
+TEST_CASE("zip - same results as index loop")
+{
+    std::vector<float> a(1'003), b(1'003);
+    std::iota(a.begin(), a.end(), 0.0f);
+    std::iota(b.begin(), b.end(), 1.0f);
+
+    REQUIRE(dot_zip(a.data(), b.data(), a.size()) == dot_index_loop(a.data(), b.data(), a.size()));
+
+    std::vector<float> expected(a.size()), result(a.size());
+    saxpy_index_loop(2.0f, a.data(), b.data(), expected.data(), a.size());
+    saxpy_zip(2.0f, a.data(), b.data(), result.data(), a.size());
+    REQUIRE(result == expected);
+}
+
+// compare generated code e.g. with -O3 -fopt-info-vec: both loops of each pair are vectorized the same way
+TEST_CASE("zip vs. index loop", "[.][benchmark]")
+{
+    const size_t size = 1'000'000;
+    std::vector<float> a(size, 1.5f), b(size, 2.0f), out(size);
+
+    BENCHMARK("dot - index loop")
+    {
+        return dot_index_loop(a.data(), b.data(), size);
+    };
+
+    BENCHMARK("dot - zip")
+    {
+        return dot_zip(a.data(), b.data(), size);
+    };
+
+    BENCHMARK("saxpy - index loop")
+    {
+        saxpy_index_loop(2.0f, a.data(), b.data(), out.data(), size);
+        return out.back();
+    };
+
+    BENCHMARK("saxpy - zip")
+    {
+        saxpy_zip(2.0f, a.data(), b.data(), out.data(), size);
+        return out.back();
+    };
+}